@@ -2,6 +2,7 @@
 #include "ClusteringArguments.h"
 #include "../../Utilities/File/File.h"
 #include "../../Utilities/String/String.h"
+#include "../../Utilities/Parser/Parser.h"
 
 const std::string &ClusteringArguments::getInputFilePath() const {
     return this->inputFilePath;
@@ -139,8 +140,8 @@ void ClusteringArguments::parseCMDArguments(char **argv, int argc, std::unordere
             return;
         }
 
-        /* Current parameter is invalid due to the fact that the file associated with the file path provided is in Windows format */
-        if (File::isInWindowsFormat(value)) {
+        /* Current parameter is invalid due to the fact that the file associated with the file path provided is a text file in Windows format */
+        if (!Parser::isBinaryCurvesFile(value) && File::isInWindowsFormat(value)) {
             std::cout << "Error : File " << value << " is in Windows format meaning its new line character set is '\\r\\n' " << std::endl;
             parseSuccessful = false;
             return;
@@ -169,8 +170,8 @@ void ClusteringArguments::parseCMDArguments(char **argv, int argc, std::unordere
             return;
         }
 
-        /* Current parameter is invalid due to the fact that the file associated with the file path provided is in Windows format */
-         if (File::isInWindowsFormat(value)) {
+        /* Current parameter is invalid due to the fact that the file associated with the file path provided is a text file in Windows format */
+         if (!Parser::isBinaryCurvesFile(value) && File::isInWindowsFormat(value)) {
             std::cout << "Error : File " << value << " is in Windows format meaning its new line character set is '\\r\\n' " << std::endl;
             parseSuccessful = false;
             return;
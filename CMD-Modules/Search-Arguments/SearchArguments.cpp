@@ -2,6 +2,9 @@
 #include "SearchArguments.h"
 #include "../../Utilities/File/File.h"
 #include "../../Utilities/String/String.h"
+#include "../../Utilities/Parser/Parser.h"
+#include "../../Utilities/Result-Writer/ResultWriter.h"
+#include "../../Hypercube-Modules/Hypercube/Hypercube.h"
 
 
 const std::string &SearchArguments::getInputFilePath() const {
@@ -16,6 +19,30 @@ const std::string &SearchArguments::getQueryFilePath() const {
     return this->queryFilePath;
 }
 
+const std::string &SearchArguments::getSaveIndexPath() const {
+    return this->saveIndexPath;
+}
+
+const std::string &SearchArguments::getLoadIndexPath() const {
+    return this->loadIndexPath;
+}
+
+const std::string &SearchArguments::getStreamPath() const {
+    return this->streamPath;
+}
+
+const std::string &SearchArguments::getGroundTruth() const {
+    return this->groundTruth;
+}
+
+const std::string &SearchArguments::getGroundTruthCachePath() const {
+    return this->groundTruthCachePath;
+}
+
+const std::string &SearchArguments::getOutputFormat() const {
+    return this->outputFormat;
+}
+
 unsigned int SearchArguments::getK() const {
     return this->k;
 }
@@ -32,7 +59,11 @@ unsigned int SearchArguments::getProbes() const {
     return this->probes;
 }
 
-long double SearchArguments::getDelta() const {
+unsigned int SearchArguments::getThreads() const {
+    return this->threads;
+}
+
+coordinate_t SearchArguments::getDelta() const {
     return this->delta;
 }
 
@@ -50,7 +81,7 @@ SearchArguments *SearchArguments::parseCMDArguments(int argc, char **argv) {
         return new SearchArguments();
 
 
-    if ((argc - 1) % 2 != 0 || argc > 23) {
+    if ((argc - 1) % 2 != 0 || argc > 37) {
         std::cout << "Error : Invalid number of arguments was provided" << std::endl;
         return nullptr;
     }
@@ -70,7 +101,14 @@ SearchArguments *SearchArguments::parseCMDArguments(int argc, char **argv) {
                                                              {"-algorithm", false},
                                                              {"-metric",    false},
                                                              {"-delta",     false},
-                                                             {"-e",         false}});
+                                                             {"-e",         false},
+                                                             {"-threads",   false},
+                                                             {"-save-index", false},
+                                                             {"-load-index", false},
+                                                             {"-stream",    false},
+                                                             {"-ground-truth", false},
+                                                             {"-ground-truth-cache", false},
+                                                             {"-output-format", false}});
 
 
     SearchArguments::parseCMDArguments(argv, argc, argumentsProvided, 1, *searchArguments, parseSuccessful);
@@ -81,6 +119,29 @@ SearchArguments *SearchArguments::parseCMDArguments(int argc, char **argv) {
         parseSuccessful = false;
     }
 
+    /* The '-load-index' parameter provides both the Input Curves and the data structure, thus they cannot be provided in any other way */
+    if (parseSuccessful && argumentsProvided["-load-index"] && (argumentsProvided["-i"] || argumentsProvided["-algorithm"] || argumentsProvided["-metric"] || argumentsProvided["-save-index"])) {
+        std::cout << "Error : The '-load-index' parameter cannot be provided alongside the '-i', '-algorithm', '-metric' or '-save-index' parameter" << std::endl;
+        parseSuccessful = false;
+    }
+
+    /* The '-stream' parameter replaces the '-q' parameter and the Query Curves are read from the standard input or a FIFO, thus nothing else may be requested interactively */
+    if (parseSuccessful && argumentsProvided["-stream"] && argumentsProvided["-q"]) {
+        std::cout << "Error : The '-stream' parameter cannot be provided alongside the '-q' parameter" << std::endl;
+        parseSuccessful = false;
+    }
+
+    if (parseSuccessful && argumentsProvided["-stream"] && (!argumentsProvided["-o"] || (!argumentsProvided["-load-index"] && (!argumentsProvided["-i"] || !argumentsProvided["-algorithm"] || (searchArguments->algorithm == "Frechet" && !argumentsProvided["-metric"]))))) {
+        std::cout << "Error : The '-stream' parameter requires the '-o' parameter and either the '-load-index' parameter or the '-i', '-algorithm' and (alongside '-algorithm Frechet') '-metric' parameters" << std::endl;
+        parseSuccessful = false;
+    }
+
+    /* The '-ground-truth-cache' parameter should be provided if and only if the '-ground-truth cached' parameter is provided */
+    if (parseSuccessful && (searchArguments->groundTruth == "cached") != argumentsProvided["-ground-truth-cache"]) {
+        std::cout << "Error : The '-ground-truth-cache' parameter should be provided if and only if the '-ground-truth cached' parameter is provided" << std::endl;
+        parseSuccessful = false;
+    }
+
     /* The '-metric' parameter can only be provided alongside the '-algorithm Frechet' parameter */
     if (parseSuccessful && argumentsProvided["-metric"] && searchArguments->algorithm != "Frechet") {
         std::cout << "Error : The '-metric' parameter can only be provided alongside the '-algorithm Frechet' parameter" << std::endl;
@@ -109,9 +170,15 @@ SearchArguments *SearchArguments::parseCMDArguments(int argc, char **argv) {
 
         if (searchArguments->algorithm == "LSH" || searchArguments->algorithm == "Frechet") {
 
-            /* Parameters '-M' and/or '-probes' cannot be provided alongside the '-algorithm LSH' or the '-algorithm Frechet' parameter */
-            if (searchArguments->M != 0 || searchArguments->probes != 0) {
-                std::cout << "Error : Parameters '-M' and/or '-probes' cannot be provided alongside the '-algorithm LSH' or the '-algorithm Frechet' parameter" << std::endl;
+            /* Parameter '-M' cannot be provided alongside the '-algorithm LSH' or the '-algorithm Frechet' parameter */
+            if (searchArguments->M != 0) {
+                std::cout << "Error : Parameter '-M' cannot be provided alongside the '-algorithm LSH' or the '-algorithm Frechet' parameter" << std::endl;
+                parseSuccessful = false;
+            }
+
+            /* Parameter '-probes' cannot be provided alongside the '-algorithm Frechet' parameter. Alongside the '-algorithm LSH' parameter it enables multi-probe LSH */
+            if (parseSuccessful && searchArguments->algorithm == "Frechet" && searchArguments->probes != 0) {
+                std::cout << "Error : Parameter '-probes' cannot be provided alongside the '-algorithm Frechet' parameter" << std::endl;
                 parseSuccessful = false;
             }
 
@@ -143,6 +210,12 @@ SearchArguments *SearchArguments::parseCMDArguments(int argc, char **argv) {
                 parseSuccessful = false;
             }
 
+            /* Parameter '-k' can be at most Hypercube::getMaxK() alongside the '-algorithm Hypercube' parameter as a Vertex is stored as a bit mask */
+            if (parseSuccessful && searchArguments->k > Hypercube::getMaxK()) {
+                std::cout << "Error : Parameter '-k' can be at most " << Hypercube::getMaxK() << " alongside the '-algorithm Hypercube' parameter" << std::endl;
+                parseSuccessful = false;
+            }
+
             /* In case the numeric parameters for Hypercube were not provided assign the default values */
             if (parseSuccessful && searchArguments->k == 0)
                 searchArguments->k = 14;
@@ -198,8 +271,8 @@ void SearchArguments::parseCMDArguments(char **argv, int argc, std::unordered_ma
             return;
         }
 
-        /* Current parameter is invalid due to the fact that the file associated with the file path provided is in Windows format */
-        if (File::isInWindowsFormat(value)) {
+        /* Current parameter is invalid due to the fact that the file associated with the file path provided is a text file in Windows format */
+        if (!Parser::isBinaryCurvesFile(value) && File::isInWindowsFormat(value)) {
             std::cout << "Error : File " << value << " is in Windows format meaning its new line character set is '\\r\\n' " << std::endl;
             parseSuccessful = false;
             return;
@@ -228,8 +301,8 @@ void SearchArguments::parseCMDArguments(char **argv, int argc, std::unordered_ma
             return;
         }
 
-        /* Current parameter is invalid due to the fact that the file associated with the file path provided is in Windows format */
-        if (File::isInWindowsFormat(value)) {
+        /* Current parameter is invalid due to the fact that the file associated with the file path provided is a text file in Windows format */
+        if (!Parser::isBinaryCurvesFile(value) && File::isInWindowsFormat(value)) {
             std::cout << "Error : File " << value << " is in Windows format meaning its new line character set is '\\r\\n' " << std::endl;
             parseSuccessful = false;
             return;
@@ -311,6 +384,23 @@ void SearchArguments::parseCMDArguments(char **argv, int argc, std::unordered_ma
 
     }
 
+    else if (parameter == "-threads") {
+
+        /* Current parameter is invalid due to the fact that its value is not a positive integer */
+        if (!String::isWholeNumber(value) || std::stoi(value) <= 0) {
+            std::cout << "Error : Parameter '" << parameter << "' should be a positive integer" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.threads = std::stoi(value);
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
     else if (parameter == "-delta") {
 
         /* Current parameter is invalid due to the fact that its value is not a positive real number */
@@ -363,6 +453,115 @@ void SearchArguments::parseCMDArguments(char **argv, int argc, std::unordered_ma
 
     }
 
+    else if (parameter == "-save-index") {
+
+        /* Current parameter is invalid due to the fact that the index file is created (or truncated) once the data structure is built */
+        if (value.empty()) {
+            std::cout << "Error : Parameter '" << parameter << "' should be a file path" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.saveIndexPath = value;
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
+    else if (parameter == "-load-index") {
+
+        /* Current parameter is invalid due to the fact that the file associated with the file path provided could not be opened */
+        if (!File::canOpenFile(value)) {
+            std::cout << "Error : Could not open file " << value << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        /* Current parameter is invalid due to the fact that the file associated with the file path provided is empty */
+        if (File::isFileEmpty(value)) {
+            std::cout << "Error : File " << value << " is empty" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.loadIndexPath = value;
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
+    else if (parameter == "-stream") {
+
+        /* Current parameter is invalid due to the fact that it is neither a file path nor '-' which stands for the standard input */
+        if (value.empty()) {
+            std::cout << "Error : Parameter '" << parameter << "' should be either a file path or '-'" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.streamPath = value;
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
+    else if (parameter == "-ground-truth") {
+
+        /* Current parameter is invalid due to the fact that its value is not exact, none or cached */
+        if (value != "exact" && value != "none" && value != "cached") {
+            std::cout << "Error : Parameter '" << parameter << "' should be either 'exact', 'none' or 'cached'" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.groundTruth = value;
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
+    else if (parameter == "-output-format") {
+
+        /* Current parameter is invalid due to the fact that its value is not text, csv or jsonl */
+        if (!ResultWriter::isFormat(value)) {
+            std::cout << "Error : Parameter '" << parameter << "' should be either 'text', 'csv' or 'jsonl'" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.outputFormat = value;
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
+    else if (parameter == "-ground-truth-cache") {
+
+        /* Current parameter is invalid due to the fact that the cache file is created (or overwritten) once new exact nearest neighbors are found */
+        if (value.empty()) {
+            std::cout << "Error : Parameter '" << parameter << "' should be a file path" << std::endl;
+            parseSuccessful = false;
+            return;
+        }
+
+        else {
+            argumentsProvided[parameter] = true;
+            searchArguments.groundTruthCachePath = value;
+            parseCMDArguments(argv, argc, argumentsProvided, i + 2, searchArguments, parseSuccessful);
+        }
+
+    }
+
     else if (parameter == "-algorithm") {
 
         /* Current parameter is invalid due to the fact that its value is not LSH, Hypercube or Frechet */
@@ -424,6 +623,6 @@ void SearchArguments::setProbes(unsigned int probes) {
     this->probes = probes;
 }
 
-long double SearchArguments::getEpsilon() const {
+coordinate_t SearchArguments::getEpsilon() const {
     return this->epsilon;
 }
@@ -4,6 +4,7 @@
 
 #include <string>
 #include <unordered_map>
+#include "../../Metric-Modules/Continuous-Frechet/include/types.hpp"
 
 class SearchArguments {
 
@@ -11,12 +12,19 @@ private:
     std::string inputFilePath = "";
     std::string outputFilePath = "";
     std::string queryFilePath = "";
+    std::string saveIndexPath = "";
+    std::string loadIndexPath = "";
+    std::string streamPath = "";
+    std::string groundTruth = "exact";
+    std::string groundTruthCachePath = "";
+    std::string outputFormat = "text";
     unsigned int k = 0;
     unsigned int L = 0;
     unsigned int M = 0;
     unsigned int probes = 0;
-    long double delta = 0.0;
-    long double epsilon = 1.0;
+    unsigned int threads = 0;
+    coordinate_t delta = 0.0;
+    coordinate_t epsilon = 1.0;
     std::string algorithm = "";
     std::string metric = "";
 
@@ -29,12 +37,19 @@ public:
     const std::string &getInputFilePath() const;
     const std::string &getOutputFilePath() const;
     const std::string &getQueryFilePath() const;
+    const std::string &getSaveIndexPath() const;
+    const std::string &getLoadIndexPath() const;
+    const std::string &getStreamPath() const;
+    const std::string &getGroundTruth() const;
+    const std::string &getGroundTruthCachePath() const;
+    const std::string &getOutputFormat() const;
     unsigned int getK() const;
     unsigned int getL() const;
     unsigned int getM() const;
     unsigned int getProbes() const;
-    long double getDelta() const;
-    long double getEpsilon() const;
+    unsigned int getThreads() const;
+    coordinate_t getDelta() const;
+    coordinate_t getEpsilon() const;
     const std::string &getAlgorithm() const;
     const std::string &getMetric() const;
 
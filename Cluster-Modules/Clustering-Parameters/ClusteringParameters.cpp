@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include "ClusteringParameters.h"
 #include "../../Utilities/String/String.h"
+#include "../../Hypercube-Modules/Hypercube/Hypercube.h"
 
 ClusteringParameters::ClusteringParameters(unsigned int kMeans, unsigned int L, unsigned int LSHK, unsigned int M, unsigned int probes, unsigned int HypercubeK) {
 
@@ -158,6 +159,13 @@ ClusteringParameters *ClusteringParameters::parseConfigurationFile(const std::st
                 return nullptr;
             }
 
+            /* Current line is invalid due to the fact that a Vertex can have at most Hypercube::getMaxK() bits */
+            if (std::stoul(lineValue) > Hypercube::getMaxK()) {
+                delete lineTokens;
+                std::cout << "Error : 'number_of_hypercube_dimensions' should be at most " << Hypercube::getMaxK() << std::endl;
+                return nullptr;
+            }
+
             linesProvided[lineKey] = true;
             HypercubeK = std::stoi(lineValue);
         }
@@ -1,6 +1,6 @@
 #include "CurveClusteringResults.h"
 
-CurveClusteringResults::CurveClusteringResults(double duration, const std::vector<CurveCluster *> &clusters, std::vector<long double> *averageSilhouettes) {
+CurveClusteringResults::CurveClusteringResults(double duration, const std::vector<CurveCluster *> &clusters, std::vector<distance_t> *averageSilhouettes) {
     this->duration = duration;
     this->clusters = clusters;
     this->averageSilhouettes = averageSilhouettes;
@@ -14,7 +14,7 @@ const std::vector<CurveCluster *> &CurveClusteringResults::getClusters() const {
     return this->clusters;
 }
 
-std::vector<long double> *CurveClusteringResults::getAverageSilhouettes() const {
+std::vector<distance_t> *CurveClusteringResults::getAverageSilhouettes() const {
     return this->averageSilhouettes;
 }
 
@@ -10,14 +10,14 @@ private:
 
     double duration;
     std::vector<CurveCluster *> clusters;
-    std::vector<long double> *averageSilhouettes;
+    std::vector<distance_t> *averageSilhouettes;
 
 public:
 
-    CurveClusteringResults(double, const std::vector<CurveCluster *> &, std::vector<long double> *);
+    CurveClusteringResults(double, const std::vector<CurveCluster *> &, std::vector<distance_t> *);
     ~CurveClusteringResults();
 
-    std::vector<long double> *getAverageSilhouettes() const;
+    std::vector<distance_t> *getAverageSilhouettes() const;
     double getDuration() const;
     const std::vector<CurveCluster *> &getClusters() const;
 
@@ -23,7 +23,7 @@ void CurveClustering::initializeCentroids(unsigned int totalClusters, CurveMetri
         std::vector<bool> isCentroid(totalCurves, false);
 
         /* Array that stores the minimum squared Frechet distance of each Curve from a Centroid */
-        std::vector<long double> squaredDistances(totalCurves, std::numeric_limits<long double>::max());
+        std::vector<distance_t> squaredDistances(totalCurves, std::numeric_limits<distance_t>::max());
 
         /* Choose the first Centroid at random */
         unsigned int randomIndex = Random::randomInteger(0, totalCurves - 1);
@@ -35,7 +35,7 @@ void CurveClustering::initializeCentroids(unsigned int totalClusters, CurveMetri
         for (unsigned int i = 1; i < totalClusters; ++i) {
 
             /* Arrays that store the distances and indices of all candidate Centroids */
-            std::vector<long double> candidatesDistances;
+            std::vector<distance_t> candidatesDistances;
             std::vector<unsigned int> candidatesIndices;
 
             for (unsigned int j = 0; j < totalCurves; ++j) {
@@ -46,7 +46,7 @@ void CurveClustering::initializeCentroids(unsigned int totalClusters, CurveMetri
                     /* Calculate the current Curve's Frechet distance from the most recently added Centroid */
                     CurveCluster *previousCluster = this->clusters[this->clusters.size() - 1];
 
-                    long double distanceToCentroid = metric->distance(*this->inputCurves->at(j), *previousCluster->getCentroid());
+                    distance_t distanceToCentroid = metric->distance(*this->inputCurves->at(j), *previousCluster->getCentroid());
 
                     distanceToCentroid *= distanceToCentroid;
 
@@ -59,9 +59,9 @@ void CurveClustering::initializeCentroids(unsigned int totalClusters, CurveMetri
                 }
             }
 
-            long double maxDistance = std::numeric_limits<long double>::min();
+            distance_t maxDistance = std::numeric_limits<distance_t>::min();
 
-            for (long double distance: candidatesDistances)
+            for (distance_t distance: candidatesDistances)
                 if (distance > maxDistance)
                     maxDistance = distance;
 
@@ -78,7 +78,7 @@ void CurveClustering::initializeCentroids(unsigned int totalClusters, CurveMetri
 
 
             /* Choose a random number between 0 and the maximum partial sum, and find which candidate Curve it corresponds to */
-            long double randomPartialSum = Random::randomLongDouble(0, candidatesDistances[candidatesDistances.size() - 1]);
+            distance_t randomPartialSum = Random::randomLongDouble(0, candidatesDistances[candidatesDistances.size() - 1]);
 
             unsigned int index = this->binarySearch(candidatesDistances, randomPartialSum);
 
@@ -91,15 +91,15 @@ void CurveClustering::initializeCentroids(unsigned int totalClusters, CurveMetri
     }
 }
 
-long double CurveClustering::calculateInitialRadius(CurveMetric *curveMetric) {
+distance_t CurveClustering::calculateInitialRadius(CurveMetric *curveMetric) {
 
-    long double minimumRadius = std::numeric_limits<long double>::max();
+    distance_t minimumRadius = std::numeric_limits<distance_t>::max();
 
     /* Calculate every possible distance between the corresponding Centroid and the rest of the Centroids */
     for (unsigned int i = 0; i < this->clusters.size() - 1; ++i)
         for (unsigned int j = i + 1; j < this->clusters.size(); j++) {
 
-            long double currentRadius = curveMetric->distance(*this->clusters[i]->getCentroid(), *this->clusters[j]->getCentroid());
+            distance_t currentRadius = curveMetric->distance(*this->clusters[i]->getCentroid(), *this->clusters[j]->getCentroid());
 
             /*  Check if the distance calculated is the shortest one yet */
             if (currentRadius < minimumRadius)
@@ -111,10 +111,10 @@ long double CurveClustering::calculateInitialRadius(CurveMetric *curveMetric) {
     return 0.5 * minimumRadius;
 }
 
-void CurveClustering::reverseRangeSearch(long double radius, CurveMetric *curveMetric, CurveMethod *methodToUse) {
+void CurveClustering::reverseRangeSearch(distance_t radius, CurveMetric *curveMetric, CurveMethod *methodToUse) {
 
     std::unordered_map<CurveCluster *, std::vector<Curve *>> clustersCurves;
-    std::unordered_map<Curve *, std::pair<CurveCluster *, long double>> curveToCluster;
+    std::unordered_map<Curve *, std::pair<CurveCluster *, distance_t>> curveToCluster;
 
 
     for (unsigned int i = 0; i < this->totalIterations; ++i) {
@@ -129,18 +129,26 @@ void CurveClustering::reverseRangeSearch(long double radius, CurveMetric *curveM
 
             for (Curve *curve: *rangeSearchNeighbors) {
 
-                /* Calculate the distance between the Curve and the CurveCluster's Centroid */
-                long double currentDistance = curveMetric->distance(*curve, *cluster->getCentroid());
-
-                /* If the corresponding Curve hasn't been assigned to a CurveCluster yet, assign it to the current CurveCluster  */
+                /* If the corresponding Curve hasn't been assigned to a CurveCluster yet, assign it to the current CurveCluster
+                 * The distance between the Curve and the CurveCluster's Centroid is only calculated in case the Curve is found by another CurveCluster as well, which is marked by a negative distance */
                 if (curveToCluster.find(curve) == curveToCluster.end())
-                    curveToCluster.insert(std::make_pair(curve, std::make_pair(cluster, currentDistance)));
+                    curveToCluster.insert(std::make_pair(curve, std::make_pair(cluster, (distance_t) -1.0)));
 
 
                     /* If the corresponding Curve has already been assigned to a CurveCluster assign it to the closest one */
-                else if (currentDistance < curveToCluster[curve].second) {
-                    curveToCluster[curve].second = currentDistance;
-                    curveToCluster[curve].first = cluster;
+                else {
+
+                    std::pair<CurveCluster *, distance_t> &assignment = curveToCluster[curve];
+
+                    if (assignment.second < 0)
+                        assignment.second = curveMetric->distance(*curve, *assignment.first->getCentroid());
+
+                    distance_t currentDistance = curveMetric->boundedDistance(*curve, *cluster->getCentroid(), assignment.second);
+
+                    if (currentDistance < assignment.second) {
+                        assignment.second = currentDistance;
+                        assignment.first = cluster;
+                    }
                 }
             }
 
@@ -148,7 +156,7 @@ void CurveClustering::reverseRangeSearch(long double radius, CurveMetric *curveM
         }
 
         /* Assign each Curve to the appropriate CurveCluster */
-        for (std::pair<Curve *const, std::pair<CurveCluster *, long double>> pair: curveToCluster)
+        for (std::pair<Curve *const, std::pair<CurveCluster *, distance_t>> pair: curveToCluster)
             clustersCurves[pair.second.first].push_back(pair.first);
 
         /* Update each CurveCluster's Centroid */
@@ -164,7 +172,7 @@ void CurveClustering::reverseRangeSearch(long double radius, CurveMetric *curveM
     std::unordered_map<Curve *, bool> *assignedCurves = new std::unordered_map<Curve *, bool>;
 
     /* Assign each Curve to the appropriate CurveCluster and mark it so that it won't get assigned to a CurveCluster during Lloyd's algorithm */
-    for (std::pair<Curve *, std::pair<CurveCluster *, long double>> pair: curveToCluster) {
+    for (std::pair<Curve *, std::pair<CurveCluster *, distance_t>> pair: curveToCluster) {
         pair.second.first->assignCurve(pair.first);
         assignedCurves->insert(std::make_pair(pair.first, true));
     }
@@ -192,11 +200,12 @@ void CurveClustering::Lloyd(std::unordered_map<Curve *, bool> *assignedCurves, u
                 /* Calculate the best-fitting CurveCluster X for the Curve.
                  * X is the one whose Centroid has the minimum distance from the Curve */
                 CurveCluster *bestCluster = this->clusters[0];
-                long double minimumDistance = std::numeric_limits<long double>::max();
+                distance_t minimumDistance = std::numeric_limits<distance_t>::max();
 
                 for (CurveCluster *cluster: this->clusters) {
 
-                    long double distanceToCentroid = curveMetric->distance(*cluster->getCentroid(), *curve);
+                    /* A Centroid farther than the closest one so far is rejected as soon as possible */
+                    distance_t distanceToCentroid = curveMetric->boundedDistance(*cluster->getCentroid(), *curve, minimumDistance);
 
                     if (distanceToCentroid < minimumDistance) {
                         minimumDistance = distanceToCentroid;
@@ -223,17 +232,17 @@ void CurveClustering::Lloyd(std::unordered_map<Curve *, bool> *assignedCurves, u
 
 }
 
-std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metric) {
+std::vector<distance_t> *CurveClustering::averageSilhouettes(CurveMetric *metric) {
 
     if (this->clusters.size() == 0 || metric == nullptr)
         return nullptr;
 
     /* Unordered map to store any distance that has already been calculated between 2 Curves
      * CurveHashFunction is used to calculate the hash value of the corresponding pair */
-    std::unordered_map<std::pair<Curve *, Curve *>, long double, CurveHashFunction> previouslyCalculatedDistances;
+    std::unordered_map<std::pair<Curve *, Curve *>, distance_t, CurveHashFunction> previouslyCalculatedDistances;
 
     /* Dynamically allocated array that stores the average Silhouette value of each CurveCluster and the average Silhouette value of Curves in the dataset */
-    std::vector<long double> *averageSilhouettes = new std::vector<long double>(this->clusters.size() + 1, 0.0);
+    std::vector<distance_t> *averageSilhouettes = new std::vector<distance_t>(this->clusters.size() + 1, 0.0);
 
     /* Array that stores which Clusters have a valid average Silhouette and which don't */
     std::vector<bool> hasValidAverageSilhouette(this->clusters.size(), true);
@@ -254,14 +263,14 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
             for (Curve *curve: *currentCluster->getAssignedCurves()) {
 
                 /* Find the second-closest CurveCluster to the current Curve */
-                long double minimumDistance = std::numeric_limits<long double>::max();
+                distance_t minimumDistance = std::numeric_limits<distance_t>::max();
                 unsigned int secondBestCluster = i;
 
                 for (unsigned int j = 0; j < this->clusters.size(); ++j)
 
                     if (j != i && !this->clusters.at(j)->getAssignedCurves()->empty()) {
 
-                        long double currentDistance = metric->distance(*curve, *this->clusters.at(j)->getCentroid());
+                        distance_t currentDistance = metric->boundedDistance(*curve, *this->clusters.at(j)->getCentroid(), minimumDistance);
 
                         if (currentDistance < minimumDistance) {
                             minimumDistance = currentDistance;
@@ -279,7 +288,7 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
                 /* Calculate the b(i) value of the current Curve.
                  * b(i) is the average distance between the corresponding Curve and all Curves that belong to the second-best CurveCluster */
                 unsigned int secondBestClusterSize = this->clusters.at(secondBestCluster)->getAssignedCurves()->size();
-                long double curvesBi = 0.0;
+                distance_t curvesBi = 0.0;
 
                 for (Curve *clusterCurve: *this->clusters.at(secondBestCluster)->getAssignedCurves()) {
 
@@ -287,13 +296,13 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
                     std::pair<Curve *, Curve *> curvePair = std::make_pair(clusterCurve, curve);
 
                     /* Define an iterator to avoid re-hashing the reversed pair at "else" section  */
-                    std::unordered_map<std::pair<Curve *, Curve *>, long double, CurveHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(curvePair);
+                    std::unordered_map<std::pair<Curve *, Curve *>, distance_t, CurveHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(curvePair);
 
                     /* In case the distance between 'curve' and 'clusterCurve' wasn't calculated recently */
                     if (pairIterator == previouslyCalculatedDistances.end()) {
 
                         /* Calculate the distance between them and store it */
-                        long double curveDistance = metric->distance(*curve, *clusterCurve);
+                        distance_t curveDistance = metric->distance(*curve, *clusterCurve);
                         previouslyCalculatedDistances.insert(std::make_pair(std::make_pair(curve, clusterCurve), curveDistance));
                         curvesBi += curveDistance;
 
@@ -304,12 +313,12 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
                         curvesBi += pairIterator->second;
                 }
 
-                curvesBi /= (long double) secondBestClusterSize;
+                curvesBi /= (distance_t) secondBestClusterSize;
 
 
                 /* Calculate the a(i) value of the current Curve
                  * a(i) is the average distance between the corresponding Curve and all Curves that belong to its CurveCluster */
-                long double curvesAi = 0.0;
+                distance_t curvesAi = 0.0;
                 for (Curve *clusterCurve: *currentCluster->getAssignedCurves())
                     if (clusterCurve != curve) {
 
@@ -317,13 +326,13 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
                         std::pair<Curve *, Curve *> curvePair = std::make_pair(clusterCurve, curve);
 
                         /* Define an iterator to avoid re-hashing the reversed pair at "else" section  */
-                        std::unordered_map<std::pair<Curve *, Curve *>, long double, CurveHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(curvePair);
+                        std::unordered_map<std::pair<Curve *, Curve *>, distance_t, CurveHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(curvePair);
 
                         /* In case the distance between 'Curve' and 'clusterCurve' wasn't calculated recently */
                         if (pairIterator == previouslyCalculatedDistances.end()) {
 
                             /* Calculate the distance between them and store it */
-                            long double curveDistance = metric->distance(*curve, *clusterCurve);
+                            distance_t curveDistance = metric->distance(*curve, *clusterCurve);
 
                             previouslyCalculatedDistances.insert(std::make_pair(std::make_pair(curve, clusterCurve), curveDistance));
                             curvesAi += curveDistance;
@@ -336,11 +345,11 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
 
                     }
 
-                curvesAi /= ((long double) clusterSize - 1.0);
+                curvesAi /= ((distance_t) clusterSize - 1.0);
 
 
                 /* Calculate the Silhouette value of the current Curve by combining the calculated a(i) and b(i) values */
-                long double currentSilhouette = (curvesBi - curvesAi) / std::max(curvesBi, curvesAi);
+                distance_t currentSilhouette = (curvesBi - curvesAi) / std::max(curvesBi, curvesAi);
                 averageSilhouettes->at(i) += currentSilhouette;
                 ++validCurves;
                 averageSilhouettes->at(averageSilhouettes->size() - 1) += currentSilhouette;
@@ -365,7 +374,7 @@ std::vector<long double> *CurveClustering::averageSilhouettes(CurveMetric *metri
 
     /* Insert the average Silhouette value of all Curves in the dataset */
     if (validCurves > 0)
-        averageSilhouettes->at(averageSilhouettes->size() - 1) /= (long double) validCurves;
+        averageSilhouettes->at(averageSilhouettes->size() - 1) /= (distance_t) validCurves;
     else
         averageSilhouettes->at(averageSilhouettes->size() - 1) = 2.0;
 
@@ -400,7 +409,7 @@ CurveClusteringResults *CurveClustering::apply(unsigned int kMeans, CurveMethod
         std::cout << "\n> Applying Reverse Range Search method..." << std::endl;
 
         /* Calculate the radius needed by Reverse Range Search and apply the algorithm */
-        long double radius = this->calculateInitialRadius(metric);
+        distance_t radius = this->calculateInitialRadius(metric);
         this->reverseRangeSearch(radius, metric, curveMethod);
 
         /* Stop the clock */
@@ -409,7 +418,7 @@ CurveClusteringResults *CurveClustering::apply(unsigned int kMeans, CurveMethod
         double totalTime = std::chrono::duration<double, std::milli>(duration).count() / 1000.0;
 
 
-        std::vector<long double> *averageSilhouettes = nullptr;
+        std::vector<distance_t> *averageSilhouettes = nullptr;
         if (silhouette) {
             std::cout << "\n> Calculating Silhouette..." << std::endl;
 
@@ -443,7 +452,7 @@ CurveClusteringResults *CurveClustering::apply(unsigned int kMeans, CurveMethod
         auto duration = finish - start;
         double totalTime = std::chrono::duration<double, std::milli>(duration).count() / 1000.0;
 
-        std::vector<long double> *averageSilhouettes = nullptr;
+        std::vector<distance_t> *averageSilhouettes = nullptr;
         if (silhouette) {
             std::cout << "\n> Calculating Silhouette..." << std::endl;
             /* Measure the CurveClustering method's accuracy by using the Silhouette metric */
@@ -458,7 +467,7 @@ CurveClusteringResults *CurveClustering::apply(unsigned int kMeans, CurveMethod
 }
 
 /* Modified binary search to use in CurveClustering::initializeCentroids */
-unsigned int CurveClustering::binarySearch(const std::vector<long double> &array, long double number) {
+unsigned int CurveClustering::binarySearch(const std::vector<distance_t> &array, distance_t number) {
 
     bool indexFound = false;
     unsigned int index = array.size() / 2;
@@ -19,10 +19,10 @@ private:
     std::vector<CurveCluster *> clusters;
     unsigned int vectorSpaceDimensions;
 
-    unsigned int binarySearch(const std::vector<long double> &, long double);
-    std::vector<long double> *averageSilhouettes(CurveMetric *);
-    void reverseRangeSearch(long double, CurveMetric *, CurveMethod *);
-    long double calculateInitialRadius(CurveMetric *);
+    unsigned int binarySearch(const std::vector<distance_t> &, distance_t);
+    std::vector<distance_t> *averageSilhouettes(CurveMetric *);
+    void reverseRangeSearch(distance_t, CurveMetric *, CurveMethod *);
+    distance_t calculateInitialRadius(CurveMetric *);
     void Lloyd(std::unordered_map<Curve *, bool> *, unsigned int, CurveMetric *);
     void initializeCentroids(unsigned int totalClusters, CurveMetric *);
 
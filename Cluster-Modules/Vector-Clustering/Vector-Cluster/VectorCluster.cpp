@@ -4,7 +4,7 @@
 VectorCluster::VectorCluster(unsigned int dimensions, const Point &point) {
 
     this->dimensions = dimensions;
-    this->centroid = new Point(point.getCoordinates());
+    this->centroid = new Point(std::vector<coordinate_t>(point.getCoordinates(), point.getCoordinates() + point.getDimensions()));
 }
 
 VectorCluster::~VectorCluster() {
@@ -25,7 +25,7 @@ void VectorCluster::updateCentroid(const std::vector<Point *> &clusterPoints) {
     if (!clusterPoints.empty()) {
 
         /* Array that stores the coordinates of the new Centroid */
-        std::vector<long double> newCoordinates(this->dimensions, 0.0);
+        std::vector<coordinate_t> newCoordinates(this->dimensions, 0.0);
 
         /* Add up the coordinates of the Points provided */
         for (Point *point: clusterPoints)
@@ -1,6 +1,6 @@
 #include "VectorClusteringResults.h"
 
-VectorClusteringResults::VectorClusteringResults(double duration, const std::vector<VectorCluster *> &clusters, std::vector<long double> *averageSilhouettes) {
+VectorClusteringResults::VectorClusteringResults(double duration, const std::vector<VectorCluster *> &clusters, std::vector<distance_t> *averageSilhouettes) {
     this->duration = duration;
     this->clusters = clusters;
     this->averageSilhouettes = averageSilhouettes;
@@ -14,7 +14,7 @@ const std::vector<VectorCluster *> &VectorClusteringResults::getClusters() const
     return this->clusters;
 }
 
-std::vector<long double> *VectorClusteringResults::getAverageSilhouettes() const {
+std::vector<distance_t> *VectorClusteringResults::getAverageSilhouettes() const {
     return this->averageSilhouettes;
 }
 
@@ -9,13 +9,13 @@ class VectorClusteringResults {
 private:
     double duration;
     std::vector<VectorCluster *> clusters;
-    std::vector<long double> *averageSilhouettes;
+    std::vector<distance_t> *averageSilhouettes;
 
 public:
-    VectorClusteringResults(double, const std::vector<VectorCluster *> &, std::vector<long double> *);
+    VectorClusteringResults(double, const std::vector<VectorCluster *> &, std::vector<distance_t> *);
     ~VectorClusteringResults();
 
-    std::vector<long double> *getAverageSilhouettes() const;
+    std::vector<distance_t> *getAverageSilhouettes() const;
     double getDuration() const;
     const std::vector<VectorCluster *> &getClusters() const;
 
@@ -29,7 +29,7 @@ void VectorClustering::initializeCentroids(unsigned int totalClusters, VectorMet
     std::vector<bool> isCentroid(totalPoints, false);
 
     /* Array that stores the minimum squared distance of each Curve from a Centroid */
-    std::vector<long double> squaredDistances(totalPoints, std::numeric_limits<long double>::max());
+    std::vector<distance_t> squaredDistances(totalPoints, std::numeric_limits<distance_t>::max());
 
     /* Choose the first Centroid at random */
     unsigned int randomIndex = Random::randomInteger(0, totalPoints - 1);
@@ -37,23 +37,26 @@ void VectorClustering::initializeCentroids(unsigned int totalClusters, VectorMet
 
     this->clusters.push_back(new VectorCluster(dimensions, *(this->inputPoints->at(randomIndex))));
 
+    /* Array that stores the distance of each Vector from the most recently added Centroid */
+    std::vector<distance_t> distancesToCentroid;
+
     /* Initialize all the remaining Centroids */
     for (unsigned int i = 1; i < totalClusters; ++i) {
 
         /* Arrays that store the distances and indices of all candidate Centroids */
-        std::vector<long double> candidatesDistances;
+        std::vector<distance_t> candidatesDistances;
         std::vector<unsigned int> candidatesIndices;
 
+        /* Calculate the Vectors' distances from the most recently added Centroid */
+        VectorCluster *previousCluster = this->clusters[this->clusters.size() - 1];
+        vectorMetric->distances(*previousCluster->getCentroid(), *this->inputPoints, distancesToCentroid);
+
         for (unsigned int j = 0; j < totalPoints; ++j) {
 
             /* If the current Vector is not a Centroid */
             if (!isCentroid[j]) {
 
-                /* Calculate the Vector's distance from the most recently added Centroid */
-                VectorCluster *previousCluster = this->clusters[this->clusters.size() - 1];
-
-                long double distanceToCentroid = vectorMetric->distance(*this->inputPoints->at(j), *previousCluster->getCentroid());
-                distanceToCentroid *= distanceToCentroid;
+                distance_t distanceToCentroid = distancesToCentroid[j] * distancesToCentroid[j];
 
                 /* If the calculated distance is the shortest one yet store it */
                 if (distanceToCentroid < squaredDistances[j])
@@ -64,9 +67,9 @@ void VectorClustering::initializeCentroids(unsigned int totalClusters, VectorMet
             }
         }
 
-        long double maxDistance = std::numeric_limits<long double>::min();
+        distance_t maxDistance = std::numeric_limits<distance_t>::min();
 
-        for (long double distance: candidatesDistances)
+        for (distance_t distance: candidatesDistances)
             if (distance > maxDistance)
                 maxDistance = distance;
 
@@ -83,7 +86,7 @@ void VectorClustering::initializeCentroids(unsigned int totalClusters, VectorMet
 
 
         /* Choose a random number between 0 and the maximum partial sum, and find which candidate Vector it corresponds to */
-        long double randomPartialSum = Random::randomLongDouble(0, candidatesDistances[candidatesDistances.size() - 1]);
+        distance_t randomPartialSum = Random::randomLongDouble(0, candidatesDistances[candidatesDistances.size() - 1]);
 
         unsigned int index = this->binarySearch(candidatesDistances, randomPartialSum);
 
@@ -96,15 +99,15 @@ void VectorClustering::initializeCentroids(unsigned int totalClusters, VectorMet
 
 }
 
-long double VectorClustering::calculateInitialRadius(VectorMetric *vectorMetric) {
+distance_t VectorClustering::calculateInitialRadius(VectorMetric *vectorMetric) {
 
-    long double minimumRadius = std::numeric_limits<long double>::max();
+    distance_t minimumRadius = std::numeric_limits<distance_t>::max();
 
     /* Calculate every possible distance between the corresponding Centroid and the rest of the Centroids */
     for (unsigned int i = 0; i < this->clusters.size() - 1; ++i)
         for (unsigned int j = i + 1; j < this->clusters.size(); j++) {
 
-            long double currentRadius = vectorMetric->distance(*this->clusters[i]->getCentroid(), *this->clusters[j]->getCentroid());
+            distance_t currentRadius = vectorMetric->distance(*this->clusters[i]->getCentroid(), *this->clusters[j]->getCentroid());
 
             /*  Check if the distance calculated is the shortest one yet */
             if (currentRadius < minimumRadius)
@@ -126,6 +129,9 @@ VectorClusteringResults *VectorClustering::apply(unsigned int kMeans, VectorMeth
     this->inputPoints = inputPoints;
     this->totalIterations = totalIterations;
 
+    /* The squared norms of the input Points are calculated once and reused by every iteration of Lloyd's method */
+    VectorMetric::squaredNorms(*this->inputPoints, this->inputSquaredNorms);
+
     /* In case of a previous execution */
     if (!this->clusters.empty())
         for (VectorCluster *cluster: this->clusters)
@@ -154,7 +160,7 @@ VectorClusteringResults *VectorClustering::apply(unsigned int kMeans, VectorMeth
     }
     else {
         std::cout << "\n> Applying Reverse Range Search method..." << std::endl;
-        long double radius = calculateInitialRadius(vectorMetric);
+        distance_t radius = calculateInitialRadius(vectorMetric);
         this->reverseRangeSearch(vectorMethod, vectorMetric, radius);
     }
 
@@ -164,7 +170,7 @@ VectorClusteringResults *VectorClustering::apply(unsigned int kMeans, VectorMeth
     double totalTime = std::chrono::duration<double, std::milli>(duration).count() / 1000.0;
 
 
-    std::vector<long double> *averageSilhouettes = nullptr;
+    std::vector<distance_t> *averageSilhouettes = nullptr;
     if (silhouette) {
 
         std::cout << "\n> Calculating Silhouette..." << std::endl;
@@ -176,10 +182,10 @@ VectorClusteringResults *VectorClustering::apply(unsigned int kMeans, VectorMeth
     return new VectorClusteringResults(totalTime, this->clusters, averageSilhouettes);
 }
 
-void VectorClustering::reverseRangeSearch(VectorMethod *methodToUse, VectorMetric *vectorMetric, long double radius) {
+void VectorClustering::reverseRangeSearch(VectorMethod *methodToUse, VectorMetric *vectorMetric, distance_t radius) {
 
     std::unordered_map<VectorCluster *, std::vector<Point *>> clustersPoints;
-    std::unordered_map<Point *, std::pair<VectorCluster *, long double>> pointToCluster;
+    std::unordered_map<Point *, std::pair<VectorCluster *, distance_t>> pointToCluster;
 
 
     for (unsigned int i = 0; i < this->totalIterations; ++i) {
@@ -195,7 +201,7 @@ void VectorClustering::reverseRangeSearch(VectorMethod *methodToUse, VectorMetri
             for (Point *point: *rangeSearchNeighbors) {
 
                 /* Calculate the distance between the Vector and the VectorCluster's Centroid */
-                long double currentDistance = vectorMetric->distance(*point, *cluster->getCentroid());
+                distance_t currentDistance = vectorMetric->distance(*point, *cluster->getCentroid());
 
                 /* If the corresponding Vector hasn't been assigned to a VectorCluster yet, assign the Curve to the current VectorCluster  */
                 if (pointToCluster.find(point) == pointToCluster.end())
@@ -212,7 +218,7 @@ void VectorClustering::reverseRangeSearch(VectorMethod *methodToUse, VectorMetri
         }
 
         /* Assign each Vector to the appropriate VectorCluster */
-        for (std::pair<Point *const, std::pair<VectorCluster *, long double>> pair: pointToCluster)
+        for (std::pair<Point *const, std::pair<VectorCluster *, distance_t>> pair: pointToCluster)
             clustersPoints[pair.second.first].push_back(pair.first);
 
         /* Update each VectorCluster's Centroid */
@@ -228,7 +234,7 @@ void VectorClustering::reverseRangeSearch(VectorMethod *methodToUse, VectorMetri
     std::unordered_map<Point *, bool> *assignedPoints = new std::unordered_map<Point *, bool>;
 
     /* Assign each Vector to the appropriate VectorCluster and mark it so that it won't get assigned to a VectorCluster during Lloyd's algorithm */
-    for (std::pair<Point *, std::pair<VectorCluster *, long double>> pair: pointToCluster) {
+    for (std::pair<Point *, std::pair<VectorCluster *, distance_t>> pair: pointToCluster) {
         pair.second.first->assignPoint(pair.first);
         assignedPoints->insert(std::make_pair(pair.first, true));
     }
@@ -243,32 +249,47 @@ void VectorClustering::Lloyd(std::unordered_map<Point *, bool> *assignedPoints,
 
     std::unordered_map<VectorCluster *, std::vector<Point *>> clustersPoints;
 
+    /* Gather the Vectors that haven't been assigned to a VectorCluster yet along with their precalculated squared norms */
+    std::vector<Point *> unassignedPoints;
+    std::vector<distance_t> unassignedSquaredNorms;
+    for (unsigned int i = 0; i < this->inputPoints->size(); ++i)
+        if (assignedPoints->find(this->inputPoints->at(i)) == assignedPoints->end()) {
+            unassignedPoints.push_back(this->inputPoints->at(i));
+            unassignedSquaredNorms.push_back(this->inputSquaredNorms[i]);
+        }
+
+    std::vector<Point *> centroids;
+    std::vector<distance_t> distancesToCentroids;
+
     for (unsigned int i = 0; i < iterations; ++i) {
 
         clustersPoints.clear();
 
-        for (Point *point: *this->inputPoints) {
+        /* Calculate the distance matrix of the Centroids and the unassigned Vectors */
+        centroids.clear();
+        for (VectorCluster *cluster: this->clusters)
+            centroids.push_back(cluster->getCentroid());
 
-            /* If the current Vector hasn't been assigned to a VectorCluster yet */
-            if (assignedPoints->find(point) == assignedPoints->end()) {
+        vectorMetric->distances(centroids, unassignedPoints, unassignedSquaredNorms, distancesToCentroids);
 
-                /* Calculate the best-fitting VectorCluster X for the Vector.
-                 * X is the one whose Centroid has the minimum distance from the Vector */
-                VectorCluster *bestCluster = this->clusters[0];
-                long double minimumDistance = std::numeric_limits<long double>::max();
+        for (unsigned int j = 0; j < unassignedPoints.size(); ++j) {
 
-                for (VectorCluster *cluster: this->clusters) {
+            /* Calculate the best-fitting VectorCluster X for the Vector.
+             * X is the one whose Centroid has the minimum distance from the Vector */
+            VectorCluster *bestCluster = this->clusters[0];
+            distance_t minimumDistance = std::numeric_limits<distance_t>::max();
 
-                    long double distanceToCentroid = vectorMetric->distance(*cluster->getCentroid(), *point);
+            for (unsigned int c = 0; c < this->clusters.size(); ++c) {
 
-                    if (distanceToCentroid < minimumDistance) {
-                        minimumDistance = distanceToCentroid;
-                        bestCluster = cluster;
-                    }
-                }
+                distance_t distanceToCentroid = distancesToCentroids[c * unassignedPoints.size() + j];
 
-                clustersPoints[bestCluster].push_back(point);
+                if (distanceToCentroid < minimumDistance) {
+                    minimumDistance = distanceToCentroid;
+                    bestCluster = this->clusters[c];
+                }
             }
+
+            clustersPoints[bestCluster].push_back(unassignedPoints[j]);
         }
 
         /* Update each VectorCluster's Centroid */
@@ -284,17 +305,17 @@ void VectorClustering::Lloyd(std::unordered_map<Point *, bool> *assignedPoints,
 
 }
 
-std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vectorMetric) {
+std::vector<distance_t> *VectorClustering::averageSilhouettes(VectorMetric *vectorMetric) {
 
     if (this->clusters.size() == 0)
         return nullptr;
 
     /* Unordered map to store any distance that has already been calculated between 2 Curves
      * VectorHashFunction is used to calculate the hash value of the corresponding pair */
-    std::unordered_map<std::pair<Point *, Point *>, long double, VectorHashFunction> previouslyCalculatedDistances;
+    std::unordered_map<std::pair<Point *, Point *>, distance_t, VectorHashFunction> previouslyCalculatedDistances;
 
     /* Dynamically allocated array that stores the average Silhouette value of each VectorCluster and the average Silhouette value of Curves in the dataset */
-    std::vector<long double> *averageSilhouettes = new std::vector<long double>(this->clusters.size() + 1, 0.0);
+    std::vector<distance_t> *averageSilhouettes = new std::vector<distance_t>(this->clusters.size() + 1, 0.0);
 
     /* Array that stores which Clusters have a valid average Silhouette and which don't */
     std::vector<bool> hasValidAverageSilhouette(this->clusters.size(), true);
@@ -315,14 +336,14 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
             for (Point *point: *currentCluster->getAssignedPoints()) {
 
                 /* Find the second-closest VectorCluster to the current Vector */
-                long double minimumDistance = std::numeric_limits<long double>::max();
+                distance_t minimumDistance = std::numeric_limits<distance_t>::max();
                 unsigned int secondBestCluster = i;
 
                 for (unsigned int j = 0; j < this->clusters.size(); ++j)
 
                     if (j != i && !this->clusters.at(j)->getAssignedPoints()->empty()) {
 
-                        long double currentDistance = vectorMetric->distance(*point, *this->clusters.at(j)->getCentroid());
+                        distance_t currentDistance = vectorMetric->distance(*point, *this->clusters.at(j)->getCentroid());
 
                         if (currentDistance < minimumDistance) {
                             minimumDistance = currentDistance;
@@ -340,7 +361,7 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
                 /* Calculate the b(i) value of the current Vector.
                  * b(i) is the average distance between the corresponding Vector and all Vectors that belong to the second-best VectorCluster */
                 unsigned int secondBestClusterSize = this->clusters.at(secondBestCluster)->getAssignedPoints()->size();
-                long double pointsBi = 0.0;
+                distance_t pointsBi = 0.0;
 
                 for (Point *clusterPoint: *this->clusters.at(secondBestCluster)->getAssignedPoints()) {
 
@@ -348,13 +369,13 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
                     std::pair<Point *, Point *> pointPair = std::make_pair(clusterPoint, point);
 
                     /* Define an iterator to avoid re-hashing the reversed pair at "else" section  */
-                    std::unordered_map<std::pair<Point *, Point *>, long double, VectorHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(pointPair);
+                    std::unordered_map<std::pair<Point *, Point *>, distance_t, VectorHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(pointPair);
 
                     /* In case the distance between 'clusterPoint' and 'point' wasn't calculated recently */
                     if (pairIterator == previouslyCalculatedDistances.end()) {
 
                         /* Calculate the distance between them and store it */
-                        long double pointDistance = vectorMetric->distance(*point, *clusterPoint);
+                        distance_t pointDistance = vectorMetric->distance(*point, *clusterPoint);
                         previouslyCalculatedDistances.insert(std::make_pair(std::make_pair(point, clusterPoint), pointDistance));
                         pointsBi += pointDistance;
 
@@ -365,12 +386,12 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
                         pointsBi += pairIterator->second;
                 }
 
-                pointsBi /= (long double) secondBestClusterSize;
+                pointsBi /= (distance_t) secondBestClusterSize;
 
 
                 /* Calculate the a(i) value of the current Vector
                  * a(i) is the average distance between the corresponding Vector and all Curves that belong to its VectorCluster */
-                long double pointsAi = 0.0;
+                distance_t pointsAi = 0.0;
                 for (Point *clusterPoint: *currentCluster->getAssignedPoints())
                     if (clusterPoint != point) {
 
@@ -378,13 +399,13 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
                         std::pair<Point *, Point *> pointPair = std::make_pair(clusterPoint, point);
 
                         /* Define an iterator to avoid re-hashing the reversed pair at "else" section  */
-                        std::unordered_map<std::pair<Point *, Point *>, long double, VectorHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(pointPair);
+                        std::unordered_map<std::pair<Point *, Point *>, distance_t, VectorHashFunction>::iterator pairIterator = previouslyCalculatedDistances.find(pointPair);
 
                         /* In case the distance between 'clusterPoint' and 'point' wasn't calculated recently */
                         if (pairIterator == previouslyCalculatedDistances.end()) {
 
                             /* Calculate the distance between them and store it */
-                            long double pointDistance = vectorMetric->distance(*point, *clusterPoint);
+                            distance_t pointDistance = vectorMetric->distance(*point, *clusterPoint);
                             previouslyCalculatedDistances.insert(std::make_pair(std::make_pair(point, clusterPoint), pointDistance));
                             pointsAi += pointDistance;
 
@@ -395,11 +416,11 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
                             pointsAi += pairIterator->second;
 
                     }
-                pointsAi /= ((long double) clusterSize - 1.0);
+                pointsAi /= ((distance_t) clusterSize - 1.0);
 
 
                 /* Calculate the Silhouette value of the current Curve by combining the calculated a(i) and b(i) values */
-                long double currentSilhouette = (pointsBi - pointsAi) / std::max(pointsBi, pointsAi);
+                distance_t currentSilhouette = (pointsBi - pointsAi) / std::max(pointsBi, pointsAi);
                 averageSilhouettes->at(i) += currentSilhouette;
                 ++validPoints;
                 averageSilhouettes->at(averageSilhouettes->size() - 1) += currentSilhouette;
@@ -424,7 +445,7 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
 
     /* Insert the average Silhouette value of all Curves in the dataset */
     if (validPoints > 0)
-        averageSilhouettes->at(averageSilhouettes->size() - 1) /= (long double) validPoints;
+        averageSilhouettes->at(averageSilhouettes->size() - 1) /= (distance_t) validPoints;
     else
         averageSilhouettes->at(averageSilhouettes->size() - 1) = 2.0;
 
@@ -432,7 +453,7 @@ std::vector<long double> *VectorClustering::averageSilhouettes(VectorMetric *vec
 }
 
 /* Modified binary search to use in VectorClustering::initializeCentroids */
-unsigned int VectorClustering::binarySearch(const std::vector<long double> &array, long double number) {
+unsigned int VectorClustering::binarySearch(const std::vector<distance_t> &array, distance_t number) {
 
     bool indexFound = false;
     unsigned int index = array.size() / 2;
@@ -15,15 +15,16 @@ class VectorClustering {
 private:
     unsigned int totalIterations;
     std::vector<Point *> *inputPoints;
+    std::vector<distance_t> inputSquaredNorms;
     std::vector<VectorCluster *> clusters;
 
     void initializeCentroids(unsigned int, VectorMetric *);
-    long double calculateInitialRadius(VectorMetric *);
+    distance_t calculateInitialRadius(VectorMetric *);
 
-    unsigned int binarySearch(const std::vector<long double> &, long double);
+    unsigned int binarySearch(const std::vector<distance_t> &, distance_t);
     void Lloyd(std::unordered_map<Point *, bool> *, unsigned int, VectorMetric *);
-    void reverseRangeSearch(VectorMethod *, VectorMetric *, long double);
-    std::vector<long double> *averageSilhouettes(VectorMetric *);
+    void reverseRangeSearch(VectorMethod *, VectorMetric *, distance_t);
+    std::vector<distance_t> *averageSilhouettes(VectorMetric *);
 
 public:
     VectorClustering();
@@ -1,7 +1,9 @@
+#include <algorithm>
+#include <limits>
 #include "Curve.h"
 #include "../../Metric-Modules/Vector-Metric/VectorMetric.h"
 
-const long double Curve::LARGE_PADDING_NUMBER = 10000.0;
+const coordinate_t Curve::LARGE_PADDING_NUMBER = 10000.0;
 
 /* Utility/Guard function to create a Curve of dimensions 1 or 2 */
 Curve *Curve::createCurve(unsigned int dimensions) {
@@ -21,6 +23,29 @@ Curve *Curve::createCurve(const std::string &id, unsigned int dimensions) {
     return new Curve(id, dimensions);
 }
 
+/* Utility/Guard function to read the Curve written by Curve::save, which returns nullptr and invalidates the IndexReader in case the Curve could not have been created */
+Curve *Curve::createCurve(IndexReader &indexReader) {
+
+    std::string id = indexReader.readString();
+    unsigned int dimensions = indexReader.readValue<uint32_t>();
+
+    std::vector<coordinate_t> coordinates;
+    indexReader.readArray(coordinates);
+
+    Curve *curve = Curve::createCurve(id, dimensions);
+
+    if (curve == nullptr || coordinates.size() % dimensions != 0) {
+        indexReader.invalidate();
+        delete curve;
+        return nullptr;
+    }
+
+    for (unsigned int i = 0; i < coordinates.size(); i += dimensions)
+        curve->insert(new Vector(std::vector<coordinate_t>(coordinates.begin() + i, coordinates.begin() + i + dimensions)));
+
+    return curve;
+}
+
 Curve::Curve(unsigned int dimensions) {
 
     this->dimensions = dimensions;
@@ -46,16 +71,41 @@ Curve::~Curve() {
         delete vector;
 }
 
+/* Function to write the Curve's id and Points. The Points are written as a single array of their concatenated coordinates */
+void Curve::save(IndexWriter &indexWriter) const {
+
+    std::vector<coordinate_t> coordinates;
+    for (Vector *vector: this->points)
+        coordinates.insert(coordinates.end(), vector->getCoordinates(), vector->getCoordinates() + vector->getDimensions());
+
+    indexWriter.writeString(this->id);
+    indexWriter.writeValue<uint32_t>(this->dimensions);
+    indexWriter.writeArray(coordinates);
+}
+
+/* Function to append a Point to the Curve, which also extends the Curve's bounding box by the Point */
 void Curve::insert(Vector *vector) {
 
     if (vector->getDimensions() == this->dimensions) {
+
+        if (this->points.empty()) {
+            this->minimumCoordinates.assign(vector->getCoordinates(), vector->getCoordinates() + this->dimensions);
+            this->maximumCoordinates.assign(vector->getCoordinates(), vector->getCoordinates() + this->dimensions);
+        }
+
+        else
+            for (unsigned int i = 0; i < this->dimensions; ++i) {
+                this->minimumCoordinates[i] = std::min(this->minimumCoordinates[i], vector->getCoordinates()[i]);
+                this->maximumCoordinates[i] = std::max(this->maximumCoordinates[i], vector->getCoordinates()[i]);
+            }
+
         this->points.push_back(vector);
         this->shouldCalculateVectorialRepresentation = true;
     }
 }
 
 /* Utility function to filter a Curve according to an e  */
-void Curve::filter(long double e) {
+void Curve::filter(coordinate_t e) {
 
     if (e < 0 || this->dimensions > 2)
         return;
@@ -88,11 +138,11 @@ void Curve::filter(long double e) {
 
         /* In case the Curve's dimensions are equal to 1 then insert a new Point in the following format {10000.0} */
         if (this->dimensions == 1)
-            this->points.push_back(new Vector(std::vector<long double>(this->dimensions, Curve::LARGE_PADDING_NUMBER)));
+            this->points.push_back(new Vector(std::vector<coordinate_t>(this->dimensions, Curve::LARGE_PADDING_NUMBER)));
 
         /* In case the Curve's dimensions are greater than or equal to 2 then insert a new Point in the following format {(x-of-latest-Point + 1.0), 10000.0, 10000.0, ... 10000.0} */
         else {
-            std::vector<long double> coordinates;
+            std::vector<coordinate_t> coordinates;
             coordinates.push_back(this->points[this->getComplexity() - 1]->getCoordinates()[0] + 1.0);
             for (unsigned int i = 1; i < this->dimensions; ++i)
                 coordinates.push_back(Curve::LARGE_PADDING_NUMBER);
@@ -100,8 +150,28 @@ void Curve::filter(long double e) {
         }
     }
 
-    /* Curve's vectorial representation should be calculated again */
+    /* Curve's vectorial representation and bounding box should be calculated again */
     this->shouldCalculateVectorialRepresentation = true;
+    this->calculateBoundingBox();
+}
+
+/* Utility function to calculate the minimum and maximum coordinates of the Curve's Points in each dimension */
+void Curve::calculateBoundingBox() {
+
+    this->minimumCoordinates.clear();
+    this->maximumCoordinates.clear();
+
+    if (this->points.empty())
+        return;
+
+    this->minimumCoordinates.assign(this->dimensions, std::numeric_limits<coordinate_t>::max());
+    this->maximumCoordinates.assign(this->dimensions, std::numeric_limits<coordinate_t>::lowest());
+
+    for (Vector *point: this->points)
+        for (unsigned int i = 0; i < this->dimensions; ++i) {
+            this->minimumCoordinates[i] = std::min(this->minimumCoordinates[i], point->getCoordinates()[i]);
+            this->maximumCoordinates[i] = std::max(this->maximumCoordinates[i], point->getCoordinates()[i]);
+        }
 }
 
 Point *Curve::getVectorialRepresentation() {
@@ -127,6 +197,15 @@ const std::vector<Vector *> &Curve::getPoints() const {
     return this->points;
 }
 
+/* The bounding box of the Curve is empty for a Curve with no Points */
+const std::vector<coordinate_t> &Curve::getMinimumCoordinates() const {
+    return this->minimumCoordinates;
+}
+
+const std::vector<coordinate_t> &Curve::getMaximumCoordinates() const {
+    return this->maximumCoordinates;
+}
+
 const std::string &Curve::getID() const {
     return this->id;
 }
@@ -143,12 +222,12 @@ void Curve::calculateVectorialRepresentation() {
     if (this->vectorialRepresentation != nullptr)
         delete this->vectorialRepresentation;
 
-    std::vector<long double> coordinates;
+    std::vector<coordinate_t> coordinates;
 
     /* For each Point in the Curve get its coordinates and insert them in the coordinates std::vector */
     for (Vector *point: this->points)
-        for (long double coordinate: point->getCoordinates())
-            coordinates.push_back(coordinate);
+        for (unsigned int i = 0; i < point->getDimensions(); ++i)
+            coordinates.push_back(point->getCoordinates()[i]);
 
 
     this->vectorialRepresentation = new Point(this, coordinates);
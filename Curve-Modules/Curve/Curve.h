@@ -4,18 +4,23 @@
 #include <vector>
 #include <string>
 #include "../../Vector-Modules/Point/Point.h"
+#include "../../Utilities/Index-Writer/IndexWriter.h"
+#include "../../Utilities/Index-Reader/IndexReader.h"
 
 class Curve{
 
 private:
-    static const long double LARGE_PADDING_NUMBER;
+    static const coordinate_t LARGE_PADDING_NUMBER;
 
     std::string id;
     unsigned int dimensions;
     std::vector<Vector *> points;
     Point *vectorialRepresentation;
     bool shouldCalculateVectorialRepresentation;
+    std::vector<coordinate_t> minimumCoordinates;
+    std::vector<coordinate_t> maximumCoordinates;
     void calculateVectorialRepresentation();
+    void calculateBoundingBox();
 
     /* Private constructors to prevent the creation of an X-dimensional Curve where X > 2 */
     Curve(unsigned int);
@@ -24,10 +29,12 @@ private:
 public:
     static Curve *createCurve(unsigned int);
     static Curve *createCurve(const std::string &, unsigned int);
+    static Curve *createCurve(IndexReader &);
     ~Curve();
+    void save(IndexWriter &) const;
 
     void insert(Vector *);
-    void filter(long double);
+    void filter(coordinate_t);
 
     Vector &operator[](unsigned int) const;
 
@@ -36,6 +43,8 @@ public:
     unsigned int getDimensions() const;
     const std::string &getID() const;
     const std::vector<Vector *> &getPoints() const;
+    const std::vector<coordinate_t> &getMinimumCoordinates() const;
+    const std::vector<coordinate_t> &getMaximumCoordinates() const;
     std::string toString() const;
 
 };
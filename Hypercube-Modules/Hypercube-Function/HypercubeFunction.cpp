@@ -9,28 +9,43 @@ HypercubeFunction::HypercubeFunction(unsigned int dimensions, double norm, unsig
     this->window = window;
 }
 
+/* Constructor that reads the HypercubeFunction written by HypercubeFunction::save */
+HypercubeFunction::HypercubeFunction(IndexReader &indexReader) {
+
+    this->randomFunction = new RandomFunction(indexReader);
+
+    std::vector<coordinate_t> coordinates;
+    indexReader.readArray(coordinates);
+    this->unitVector = new Vector(coordinates);
+
+    this->shift = indexReader.readValue<float>();
+    this->window = indexReader.readValue<uint32_t>();
+}
+
 HypercubeFunction::~HypercubeFunction() {
 
     delete this->randomFunction;
     delete this->unitVector;
 }
 
+void HypercubeFunction::save(IndexWriter &indexWriter) const {
+
+    this->randomFunction->save(indexWriter);
+    indexWriter.writeArray(this->unitVector->getCoordinates(), this->unitVector->getDimensions());
+    indexWriter.writeValue<float>(this->shift);
+    indexWriter.writeValue<uint32_t>(this->window);
+}
 
-std::string HypercubeFunction::hash(const Point &point) {
+int HypercubeFunction::hash(const Point &point) const {
 
     /* Calculate the <Point,unitVector> and add the HypercubeFunction's shift to it */
-    long double numerator = (*this->unitVector * (Vector &) point) + this->shift;
+    coordinate_t numerator = (*this->unitVector * (Vector &) point) + this->shift;
 
     /* Calculate the corresponding bucket/index */
     long long int index = floor(numerator / this->window);
 
-    /* If the index is not mapped to 0 or 1 already then map it using the HypercubeFunction's randomFunction
-     * and store the value calculated (0/1) for future use */
-    if (this->buckets.find(index) == this->buckets.end())
-        this->buckets[index] = std::to_string(this->randomFunction->coinFlip());
-
-    /* Return the appropriate value (0/1) */
-    return this->buckets[index];
+    /* Map the index to 0 or 1 using the HypercubeFunction's randomFunction and return the appropriate value (0/1) */
+    return this->randomFunction->coinFlip(index);
 }
 
 
@@ -1,7 +1,6 @@
 #ifndef HYPERCUBEFUNCTION_H
 #define HYPERCUBEFUNCTION_H
 
-#include <unordered_map>
 #include "../../Vector-Modules/Point/Point.h"
 #include "../Random-Function/RandomFunction.h"
 
@@ -16,13 +15,13 @@ private:
     Vector *unitVector;
     float shift;
     unsigned int window;
-    /* Data structure used to store a just/previously calculated h_i() value and its appropriate mapping to 0 or 1 */
-    std::unordered_map<long long int, std::string> buckets;
 
 public:
     HypercubeFunction(unsigned int, double, unsigned int);
+    explicit HypercubeFunction(IndexReader &);
     ~HypercubeFunction();
-    std::string hash(const Point &);
+    void save(IndexWriter &) const;
+    int hash(const Point &) const;
 
 };
 
@@ -11,6 +11,22 @@ HypercubeHashFunction::HypercubeHashFunction(unsigned int dimensions, double nor
 
 }
 
+/* Constructor that reads the HypercubeHashFunction written by HypercubeHashFunction::save */
+HypercubeHashFunction::HypercubeHashFunction(IndexReader &indexReader) {
+
+    this->k = indexReader.readValue<uint32_t>();
+
+    /* A Vertex is stored as a 64-bit mask */
+    if (this->k > 64) {
+        indexReader.invalidate();
+        this->k = 0;
+    }
+
+    this->hypercubeFunctions = new HypercubeFunction *[this->k];
+    for (unsigned int i = 0; i < this->k; ++i)
+        this->hypercubeFunctions[i] = new HypercubeFunction(indexReader);
+}
+
 HypercubeHashFunction::~HypercubeHashFunction() {
 
     for (unsigned int i = 0; i < this->k; ++i)
@@ -20,13 +36,24 @@ HypercubeHashFunction::~HypercubeHashFunction() {
 
 }
 
-std::string HypercubeHashFunction::hash(const Point &point) {
+void HypercubeHashFunction::save(IndexWriter &indexWriter) const {
 
-    std::string vertex;
+    indexWriter.writeValue<uint32_t>(this->k);
+    for (unsigned int i = 0; i < this->k; ++i)
+        this->hypercubeFunctions[i]->save(indexWriter);
+}
+
+uint64_t HypercubeHashFunction::hash(const Point &point) const {
 
-    /* Calculate the k f_i(h_i(v_i)) values for the given Point and concatenate them */
+    uint64_t vertex = 0;
+
+    /* Calculate the k f_i(h_i(v_i)) values for the given Point and store the ith one in the ith bit */
     for (unsigned int i = 0; i < this->k; ++i)
-        vertex += this->hypercubeFunctions[i]->hash(point);
+        vertex |= (uint64_t) this->hypercubeFunctions[i]->hash(point) << i;
 
     return vertex;
 }
+
+unsigned int HypercubeHashFunction::getK() const {
+    return this->k;
+}
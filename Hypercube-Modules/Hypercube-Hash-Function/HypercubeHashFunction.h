@@ -1,8 +1,12 @@
 #ifndef HYPERCUBEHASHFUNCTION_H
 #define HYPERCUBEHASHFUNCTION_H
 
+#include <cstdint>
 #include "../Hypercube-Function/HypercubeFunction.h"
 
+/* Class that maps a Point to a Vertex of the k-dimensional Hypercube
+ * The Vertex is represented as a bit mask whose ith bit is f_i(h_i()), thus k can be at most 64 */
+
 class HypercubeHashFunction {
 
 private:
@@ -11,8 +15,11 @@ private:
 
 public:
     HypercubeHashFunction(unsigned int, double, unsigned int, unsigned int);
+    explicit HypercubeHashFunction(IndexReader &);
     ~HypercubeHashFunction();
-    std::string hash(const Point &);
+    void save(IndexWriter &) const;
+    uint64_t hash(const Point &) const;
+    unsigned int getK() const;
 };
 
 
@@ -1,64 +1,130 @@
 #include <chrono>
 #include <algorithm>
+#include <random>
 #include "Hypercube.h"
-#include "../../Utilities/String/String.h"
+#include "../../Utilities/Bounded-Heap/BoundedHeap.h"
+#include "../../Utilities/Arithmetic/Arithmetic.h"
+#include "../../Utilities/Parallel/Parallel.h"
+
+/* A Vertex is stored as a 64-bit mask */
+const unsigned int Hypercube::MAX_K = 64;
+const unsigned int Hypercube::BLOCK_SIZE = 1024;
 
 Hypercube::Hypercube(unsigned int dimensions, double norm, unsigned int k, unsigned int w, unsigned int probes, unsigned int M) : VectorMethod(dimensions, norm, k, w) {
 
+    if (this->k > Hypercube::MAX_K)
+        this->k = Hypercube::MAX_K;
+
     this->probes = probes;
     this->M = M;
-    this->hypercubeHashFunction = new HypercubeHashFunction(dimensions, norm, w, k);
+    this->hypercubeHashFunction = new HypercubeHashFunction(dimensions, norm, w, this->k);
+    this->vertices = new VertexTable();
 }
 
-Hypercube::~Hypercube() {
+/* Constructor that reads the Hypercube written by Hypercube::save, given the dataset that its Points were inserted from */
+Hypercube::Hypercube(IndexReader &indexReader, const std::vector<Point *> &dataset) : VectorMethod(indexReader) {
+
+    this->M = indexReader.readValue<uint32_t>();
+    this->probes = indexReader.readValue<uint32_t>();
+    this->hypercubeHashFunction = new HypercubeHashFunction(indexReader);
+    this->vertices = new VertexTable();
+
+    if (this->hypercubeHashFunction->getK() != this->k)
+        indexReader.invalidate();
+
+    /* The Points of each Vertex are inserted in the order they were stored */
+    uint64_t totalVertices = indexReader.readValue<uint64_t>();
+    for (uint64_t i = 0; i < totalVertices && indexReader.isValid(); ++i) {
+
+        uint64_t vertex = indexReader.readValue<uint64_t>();
+
+        std::vector<Point *> vertexPoints;
+        VectorMethod::loadPoints(indexReader, dataset, vertexPoints);
 
-    for (std::pair<std::string, std::vector<Point *> *> pair: this->vertices)
-        delete pair.second;
+        for (Point *point: vertexPoints)
+            this->vertices->insert(vertex, point);
+    }
+}
+
+Hypercube::~Hypercube() {
 
+    delete this->vertices;
     delete this->hypercubeHashFunction;
 }
 
+unsigned int Hypercube::getMaxK() {
+    return Hypercube::MAX_K;
+}
+
+/* Function to write the Hypercube, given the dataset that its Points were inserted from */
+void Hypercube::save(IndexWriter &indexWriter, const std::vector<Point *> &dataset) const {
+
+    Method::save(indexWriter);
+    indexWriter.writeValue<uint32_t>(this->M);
+    indexWriter.writeValue<uint32_t>(this->probes);
+    this->hypercubeHashFunction->save(indexWriter);
+
+    indexWriter.writeValue<uint64_t>(this->vertices->getSize());
+    for (unsigned int i = 0; i < this->vertices->getSize(); ++i) {
+        indexWriter.writeValue<uint64_t>(this->vertices->getVertex(i));
+        VectorMethod::savePoints(indexWriter, this->vertices->getPoints(i), dataset);
+    }
+}
+
 void Hypercube::insertPoint(Point *const point) {
 
     if (point->getDimensions() == this->dimensions) {
 
         /* Calculate the Vertex of the given Point */
-        std::string inputPointVertex = this->hypercubeHashFunction->hash(*point);
-
-        /* If the Vertex calculated hasn't been encountered before then create an array for its Points */
-        if (this->vertices.find(inputPointVertex) == this->vertices.end())
-            this->vertices[inputPointVertex] = new std::vector<Point *>;
+        uint64_t inputPointVertex = this->hypercubeHashFunction->hash(*point);
 
         /* Insert the Point given to the calculated Vertex's array */
-        this->vertices[inputPointVertex]->push_back(point);
+        this->vertices->insert(inputPointVertex, point);
     }
 
 }
 
+/* Function to insert the given Points in bulk using at most the given number of threads
+ * The Vertices of the Points are calculated in parallel and then the Points are inserted to the Vertices' arrays in the given order */
+void Hypercube::build(const std::vector<Point *> &points, unsigned int threads) {
+
+    std::vector<uint64_t> inputPointVertices(points.size());
+
+    Parallel::parallelForBlocks(points.size(), Hypercube::BLOCK_SIZE, threads, [&](unsigned int first, unsigned int last) {
+        for (unsigned int i = first; i < last; ++i)
+            if (points[i]->getDimensions() == this->dimensions)
+                inputPointVertices[i] = this->hypercubeHashFunction->hash(*points[i]);
+    });
+
+    for (unsigned int i = 0; i < points.size(); ++i)
+        if (points[i]->getDimensions() == this->dimensions)
+            this->vertices->insert(inputPointVertices[i], points[i]);
+}
+
 /* Function to perform R-range-search given a Vector metric */
-std::vector<Point *> *Hypercube::rangeSearch(Point *const queryPoint, long double R, VectorMetric *vectorMetric) {
+std::vector<Point *> *Hypercube::rangeSearch(Point *const queryPoint, distance_t R, VectorMetric *vectorMetric) const {
 
 
     std::vector<Point *> *similarPoints = new std::vector<Point *>;
 
     if (queryPoint->getDimensions() == this->dimensions) {
 
-        std::string queryPointVertex = this->hypercubeHashFunction->hash(*queryPoint);
+        uint64_t queryPointVertex = this->hypercubeHashFunction->hash(*queryPoint);
 
-        std::vector<std::string> *verticesToVisit = this->getVerticesToVisit(queryPointVertex);
+        std::vector<uint64_t> *verticesToVisit = this->getVerticesToVisit(queryPointVertex);
 
         /* Variable to check if M Points have been considered */
         unsigned int totalPointsChecked = 0;
 
-        for (const std::string &vertexToVisit: *verticesToVisit) {
+        for (uint64_t vertexToVisit: *verticesToVisit) {
 
             /* Get the Points of the appropriate Vertex */
-            std::vector<Point *> *vertexPoints = this->vertices[vertexToVisit];
+            const std::vector<Point *> *vertexPoints = this->vertices->find(vertexToVisit);
 
             /* For each Point calculate its distance to the Query Point and check if it's less than or equal to R */
             for (Point *vertexPoint: *vertexPoints) {
 
-                long double distance = vectorMetric->distance(*queryPoint, *vertexPoint);
+                distance_t distance = vectorMetric->distance(*queryPoint, *vertexPoint);
 
                 if (distance <= R)
                     similarPoints->push_back(vertexPoint);
@@ -80,33 +146,33 @@ std::vector<Point *> *Hypercube::rangeSearch(Point *const queryPoint, long doubl
 }
 
 /* Function to get the best approximate nearest neighbor given a Vector metric */
-std::tuple<Point *, long double, double> Hypercube::getApproximateNearestNeighbor(Point *const queryPoint, VectorMetric *vectorMetric) {
+std::tuple<Point *, distance_t, double> Hypercube::getApproximateNearestNeighbor(Point *const queryPoint, VectorMetric *vectorMetric) const {
 
     if (queryPoint->getDimensions() == this->dimensions) {
 
-        std::tuple<Point *, long double, double> neighbor;
+        std::tuple<Point *, distance_t, double> neighbor;
 
         unsigned int totalPointsChecked = 0;
-        long double minDistance = std::numeric_limits<long double>::max();
+        distance_t minDistance = std::numeric_limits<distance_t>::max();
         Point *nearestNeighbor = nullptr;
 
         /* Start the clock */
         std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
 
-        std::string queryPointVertex = this->hypercubeHashFunction->hash(*queryPoint);
+        uint64_t queryPointVertex = this->hypercubeHashFunction->hash(*queryPoint);
 
-        std::vector<std::string> *verticesToVisit = this->getVerticesToVisit(queryPointVertex);
+        std::vector<uint64_t> *verticesToVisit = this->getVerticesToVisit(queryPointVertex);
 
-        for (const std::string &vertexToVisit: *verticesToVisit) {
+        for (uint64_t vertexToVisit: *verticesToVisit) {
 
             if (totalPointsChecked == this->M || minDistance == 0.0)
                 break;
 
-            std::vector<Point *> *vertexPoints = this->vertices[vertexToVisit];
+            const std::vector<Point *> *vertexPoints = this->vertices->find(vertexToVisit);
 
             for (Point *vertexPoint: *vertexPoints) {
 
-                long double distance = vectorMetric->distance(*queryPoint, *vertexPoint);
+                distance_t distance = vectorMetric->distance(*queryPoint, *vertexPoint);
 
                 if (distance < minDistance) {
                     minDistance = distance;
@@ -136,31 +202,94 @@ std::tuple<Point *, long double, double> Hypercube::getApproximateNearestNeighbo
         return std::make_tuple(nullptr, -1.0, -1.0);
 }
 
+/* Function to get the (at most) k approximate nearest neighbors given a Vector metric, sorted in ascending order of their distances */
+std::vector<std::pair<Point *, distance_t>> *Hypercube::getKNearestNeighbors(Point *const queryPoint, unsigned int k, VectorMetric *vectorMetric) const {
+
+    BoundedHeap<Point *> nearestNeighbors(k);
+
+    if (queryPoint->getDimensions() == this->dimensions) {
+
+        unsigned int totalPointsChecked = 0;
+
+        uint64_t queryPointVertex = this->hypercubeHashFunction->hash(*queryPoint);
+
+        std::vector<uint64_t> *verticesToVisit = this->getVerticesToVisit(queryPointVertex);
+
+        for (uint64_t vertexToVisit: *verticesToVisit) {
+
+            if (totalPointsChecked == this->M)
+                break;
+
+            const std::vector<Point *> *vertexPoints = this->vertices->find(vertexToVisit);
+
+            for (Point *vertexPoint: *vertexPoints) {
+
+                nearestNeighbors.push(vertexPoint, vectorMetric->distance(*queryPoint, *vertexPoint));
+
+                totalPointsChecked++;
+
+                if (totalPointsChecked == this->M)
+                    break;
+            }
+        }
+
+        delete verticesToVisit;
+    }
+
+    return nearestNeighbors.toSortedVector();
+}
+
 /* Utility function to get the Vertices that their Hamming Distance is equal to X given a Point's Vertex */
-std::vector<std::string> *Hypercube::getVerticesWithHammingDistance(const std::string &pointVertex, unsigned int i) {
+std::vector<uint64_t> *Hypercube::getVerticesWithHammingDistance(uint64_t pointVertex, unsigned int i) const {
+
+    std::vector<uint64_t> *appropriateVertices = new std::vector<uint64_t>;
+
+    /* There are C(k,i) Vertices whose Hamming Distance from the given Vertex is equal to i */
+    double totalCandidates = Arithmetic::binomialCoefficient(this->k, i);
+
+    /* If they are at most as many as the populated Vertices then enumerate them by flipping every combination of i out of the k bits and keep the populated ones */
+    if (totalCandidates <= this->vertices->getSize()) {
+
+        uint64_t flips = i == 64 ? ~0ULL : (1ULL << i) - 1;
 
-    std::vector<std::string> *appropriateVertices = new std::vector<std::string>;
+        for (unsigned long int j = 0; j < (unsigned long int) totalCandidates; ++j) {
 
-    for (std::pair<std::string, std::vector<Point *> *> pair: this->vertices)
-        if (String::hammingDistance(pointVertex, pair.first) == i)
-            appropriateVertices->push_back(pair.first);
+            if (this->vertices->find(pointVertex ^ flips) != nullptr)
+                appropriateVertices->push_back(pointVertex ^ flips);
+
+            /* Gosper's hack : the next greater bit mask with the same number of bits set */
+            if (flips != 0) {
+                uint64_t lowestBit = flips & -flips;
+                uint64_t ripple = flips + lowestBit;
+                flips = (((ripple ^ flips) >> 2) / lowestBit) | ripple;
+            }
+        }
+    }
+
+    /* Otherwise scanning the populated Vertices is cheaper */
+    else
+        for (unsigned int j = 0; j < this->vertices->getSize(); ++j)
+            if (Arithmetic::hammingDistance(pointVertex, this->vertices->getVertex(j)) == i)
+                appropriateVertices->push_back(this->vertices->getVertex(j));
 
     return appropriateVertices;
 }
 
 /* Utility function to get the appropriate Vertices to consider/visit given a Point's Vertex */
-std::vector<std::string> *Hypercube::getVerticesToVisit(const std::string &pointVertex) {
+std::vector<uint64_t> *Hypercube::getVerticesToVisit(uint64_t pointVertex) const {
+
+    std::vector<uint64_t> *verticesToVisit = new std::vector<uint64_t>;
 
-    std::vector<std::string> *verticesToVisit = new std::vector<std::string>;
+    std::default_random_engine defaultRandomEngine(std::chrono::high_resolution_clock::now().time_since_epoch().count());
 
-    /* Say k is equal to 3 then the minimum-maximum Hamming Distances will be : 0-3 */
-    for (unsigned int i = 0; i <= this->k; ++i) {
+    /* Say k is equal to 3 then the minimum-maximum Hamming Distances will be : 0-3
+     * The search stops as soon as '-probes' Vertices have been found or every populated Vertex has been found */
+    for (unsigned int i = 0; i <= this->k && verticesToVisit->size() < this->vertices->getSize(); ++i) {
 
         /* Get the Vertices that their Hamming Distance is equal to i  */
-        std::vector<std::string> *appropriateVertices = this->getVerticesWithHammingDistance(pointVertex, i);
+        std::vector<uint64_t> *appropriateVertices = this->getVerticesWithHammingDistance(pointVertex, i);
 
         /* Sprinkle some randomness */
-        std::default_random_engine defaultRandomEngine(std::chrono::high_resolution_clock::now().time_since_epoch().count());
         std::shuffle(appropriateVertices->begin(), appropriateVertices->end(), defaultRandomEngine);
 
         for (long unsigned int j = 0; j < appropriateVertices->size(); ++j) {
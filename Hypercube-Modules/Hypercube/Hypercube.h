@@ -2,26 +2,36 @@
 #define HYPERCUBE_H
 
 #include "../Hypercube-Hash-Function/HypercubeHashFunction.h"
+#include "../Vertex-Table/VertexTable.h"
 #include "../../Method-Modules/Vector-Method/VectorMethod.h"
 
 class Hypercube : public VectorMethod {
 
 private:
+    static const unsigned int MAX_K;
+    static const unsigned int BLOCK_SIZE;
+
     unsigned int M;
     unsigned int probes;
     HypercubeHashFunction *hypercubeHashFunction;
-    std::unordered_map<std::string, std::vector<Point *> *> vertices;
+    VertexTable *vertices;
 
-    std::vector<std::string> *getVerticesToVisit(const std::string &);
-    std::vector<std::string> *getVerticesWithHammingDistance(const std::string &, unsigned int);
+    std::vector<uint64_t> *getVerticesToVisit(uint64_t) const;
+    std::vector<uint64_t> *getVerticesWithHammingDistance(uint64_t, unsigned int) const;
 
 public:
+    static unsigned int getMaxK();
+
     Hypercube(unsigned int, double, unsigned int, unsigned int, unsigned int, unsigned int);
+    Hypercube(IndexReader &, const std::vector<Point *> &);
     ~Hypercube();
 
+    void save(IndexWriter &, const std::vector<Point *> &) const;
     void insertPoint(Point *const);
-    std::vector<Point *> *rangeSearch(Point *const, long double, VectorMetric *);
-    std::tuple<Point *, long double, double> getApproximateNearestNeighbor(Point *const, VectorMetric *);
+    void build(const std::vector<Point *> &, unsigned int);
+    std::vector<Point *> *rangeSearch(Point *const, distance_t, VectorMetric *) const;
+    std::tuple<Point *, distance_t, double> getApproximateNearestNeighbor(Point *const, VectorMetric *) const;
+    std::vector<std::pair<Point *, distance_t>> *getKNearestNeighbors(Point *const, unsigned int, VectorMetric *) const;
 
 };
 
@@ -1,22 +1,34 @@
 #include <chrono>
+#include <random>
 #include "RandomFunction.h"
 
 RandomFunction::RandomFunction() {
 
-    this->defaultRandomEngine = new std::default_random_engine (std::chrono::high_resolution_clock::now().time_since_epoch().count());
-    this->intDistribution = new std::uniform_int_distribution<>(0, 1);
+    std::mt19937_64 randomEngine(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    this->seed = randomEngine();
 }
 
+/* Constructor that reads the seed written by RandomFunction::save, thus every index is mapped to the same value as before */
+RandomFunction::RandomFunction(IndexReader &indexReader) {
+    this->seed = indexReader.readValue<uint64_t>();
+}
 
-int RandomFunction::coinFlip() {
-
-    /* Return 0 or 1 at random */
-    return this->intDistribution->operator()(*this->defaultRandomEngine);
+void RandomFunction::save(IndexWriter &indexWriter) const {
+    indexWriter.writeValue<uint64_t>(this->seed);
 }
 
-RandomFunction::~RandomFunction() {
-    delete this->intDistribution;
-    delete this->defaultRandomEngine;
+int RandomFunction::coinFlip(long long int index) const {
+
+    /* Mix the index with the seed (SplitMix64 finalizer) so that every bit of the index affects the outcome */
+    uint64_t mixed = (uint64_t) index + this->seed + 0x9E3779B97F4A7C15ULL;
+    mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+    mixed = mixed ^ (mixed >> 31);
+
+    /* Return 0 or 1 */
+    return (int) (mixed & 1);
 }
 
+RandomFunction::~RandomFunction() {}
+
 
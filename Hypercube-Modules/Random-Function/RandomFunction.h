@@ -2,20 +2,25 @@
 #define RANDOMFUNCTION_H
 
 
-#include <random>
+#include <cstdint>
+#include "../../Utilities/Index-Writer/IndexWriter.h"
+#include "../../Utilities/Index-Reader/IndexReader.h"
 
-/* Class that acts as the f_i() function in the context of the Hypercube algorithm */
+/* Class that acts as the f_i() function in the context of the Hypercube algorithm
+ * Instead of flipping a coin the first time an index is encountered and storing the outcome, the outcome is derived from a hash of the index and a random seed
+ * Thus the same index is always mapped to the same value and f_i() can be evaluated concurrently without any shared mutable state */
 
 class RandomFunction {
 
 private:
-    std::default_random_engine *defaultRandomEngine;
-    std::uniform_int_distribution<int>* intDistribution;
+    uint64_t seed;
 
 public:
     RandomFunction();
+    explicit RandomFunction(IndexReader &);
     ~RandomFunction();
-    int coinFlip();
+    void save(IndexWriter &) const;
+    int coinFlip(long long int) const;
 
 };
 
@@ -0,0 +1,87 @@
+#include "VertexTable.h"
+
+const unsigned int VertexTable::INITIAL_CAPACITY = 16;
+const int VertexTable::EMPTY_SLOT = -1;
+
+VertexTable::VertexTable() {
+
+    this->capacity = VertexTable::INITIAL_CAPACITY;
+    this->slots = new int[this->capacity];
+    for (unsigned int i = 0; i < this->capacity; ++i)
+        this->slots[i] = VertexTable::EMPTY_SLOT;
+}
+
+VertexTable::~VertexTable() {
+    delete[] this->slots;
+}
+
+/* Utility function to get the slot of the index that either stores the given Vertex or is the first empty slot of its probe sequence */
+unsigned int VertexTable::getSlot(uint64_t vertex) const {
+
+    /* Fibonacci hashing spreads Vertices that differ in a few low bits across the whole index
+     * The capacity is always a power of 2, thus (capacity - 1) acts as a mask */
+    unsigned int slot = (unsigned int) ((vertex * 0x9E3779B97F4A7C15ULL) >> 32) & (this->capacity - 1);
+
+    while (this->slots[slot] != VertexTable::EMPTY_SLOT && this->vertices[this->slots[slot]] != vertex)
+        slot = (slot + 1) & (this->capacity - 1);
+
+    return slot;
+}
+
+/* Utility function to double the capacity of the index and reinsert every Vertex */
+void VertexTable::grow() {
+
+    delete[] this->slots;
+
+    this->capacity *= 2;
+    this->slots = new int[this->capacity];
+    for (unsigned int i = 0; i < this->capacity; ++i)
+        this->slots[i] = VertexTable::EMPTY_SLOT;
+
+    for (unsigned int i = 0; i < this->vertices.size(); ++i)
+        this->slots[this->getSlot(this->vertices[i])] = (int) i;
+}
+
+void VertexTable::insert(uint64_t vertex, Point *point) {
+
+    unsigned int slot = this->getSlot(vertex);
+    int position = this->slots[slot];
+
+    /* If the Vertex hasn't been encountered before then create an array for its Points */
+    if (position == VertexTable::EMPTY_SLOT) {
+
+        position = (int) this->vertices.size();
+        this->vertices.push_back(vertex);
+        this->vertexPoints.push_back(std::vector<Point *>());
+        this->slots[slot] = position;
+
+        /* The load factor of the index is kept at most 1/2 so that probe sequences remain short */
+        if (2 * this->vertices.size() > this->capacity)
+            this->grow();
+    }
+
+    this->vertexPoints[position].push_back(point);
+}
+
+/* Returns the Points of the given Vertex or nullptr in case the Vertex is not populated */
+const std::vector<Point *> *VertexTable::find(uint64_t vertex) const {
+
+    unsigned int slot = this->getSlot(vertex);
+
+    if (this->slots[slot] == VertexTable::EMPTY_SLOT)
+        return nullptr;
+
+    return &this->vertexPoints[this->slots[slot]];
+}
+
+unsigned int VertexTable::getSize() const {
+    return this->vertices.size();
+}
+
+uint64_t VertexTable::getVertex(unsigned int i) const {
+    return this->vertices[i];
+}
+
+const std::vector<Point *> &VertexTable::getPoints(unsigned int i) const {
+    return this->vertexPoints[i];
+}
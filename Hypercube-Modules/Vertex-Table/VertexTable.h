@@ -0,0 +1,39 @@
+#ifndef VERTEXTABLE_H
+#define VERTEXTABLE_H
+
+#include <vector>
+#include <cstdint>
+#include "../../Vector-Modules/Point/Point.h"
+
+/* Hash table that maps a Hypercube Vertex, represented as a k-bit mask, to the Points assigned to it
+ * The Vertices and their Points are stored densely in insertion order, while an open-addressing (linear probing) index maps a Vertex to its position
+ * Thus a lookup is a few probes in a flat array and visiting every populated Vertex is a linear scan */
+
+class VertexTable {
+
+private:
+    static const unsigned int INITIAL_CAPACITY;
+    static const int EMPTY_SLOT;
+
+    std::vector<uint64_t> vertices;
+    std::vector<std::vector<Point *>> vertexPoints;
+    int *slots;
+    unsigned int capacity;
+
+    unsigned int getSlot(uint64_t) const;
+    void grow();
+
+public:
+    VertexTable();
+    ~VertexTable();
+
+    void insert(uint64_t, Point *);
+    const std::vector<Point *> *find(uint64_t) const;
+
+    unsigned int getSize() const;
+    uint64_t getVertex(unsigned int) const;
+    const std::vector<Point *> &getPoints(unsigned int) const;
+};
+
+
+#endif
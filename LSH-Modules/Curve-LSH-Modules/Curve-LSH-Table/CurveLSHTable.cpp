@@ -1,5 +1,8 @@
 #include "CurveLSHTable.h"
 #include "../../../Utilities/Arithmetic/Arithmetic.h"
+#include "../../../Utilities/Parallel/Parallel.h"
+
+const unsigned int CurveLSHTable::BLOCK_SIZE = 4096;
 
 /* ----
  *
@@ -8,11 +11,11 @@
  *
  * (1) X's Grid Curve say Y is calculated in the Grid class.
  * (2) Grid::snap returns the vectorial representation of Y say V
- * (3) V gets hashed and inserted in the corresponding bucket alongside its amplified hash value
+ * (3) V gets hashed and X's id gets inserted in the corresponding bucket alongside V's amplified hash value
  *
  * ---- */
 
-CurveLSHTable::CurveLSHTable(unsigned int id, unsigned int dimensions, double norm, unsigned int window, unsigned int k, unsigned int size, unsigned int gridDimensions, long double delta, bool continuous) {
+CurveLSHTable::CurveLSHTable(unsigned int id, unsigned int dimensions, double norm, unsigned int window, unsigned int k, unsigned int size, unsigned int gridDimensions, coordinate_t delta, bool continuous) {
 
     this->id = id;
     this->size = size;
@@ -22,82 +25,173 @@ CurveLSHTable::CurveLSHTable(unsigned int id, unsigned int dimensions, double no
     this->grid = Grid::createGrid(dimensions, gridDimensions, delta, continuous);
 
     /* See README above */
-    this->buckets = new std::vector<std::pair<unsigned int, Point *>>[size];
+    this->buckets = new std::vector<std::pair<unsigned int, unsigned int>>[size];
+}
+
+/* Constructor that reads the hash table written by CurveLSHTable::save, whose entries should be ids less than the given number of Curves
+ * The Grid should snap a Curve to a Point of the given dimensions, which is what the amplified hash function should take, otherwise a query would hash a nullptr or an invalid projection */
+CurveLSHTable::CurveLSHTable(IndexReader &indexReader, unsigned int totalCurves, unsigned int dimensions) {
+
+    this->id = indexReader.readValue<uint32_t>();
+    this->size = indexReader.readValue<uint32_t>();
+    this->lshHashFunction = new LSHHashFunction(indexReader);
+    this->grid = Grid::createGrid(indexReader);
+
+    if (this->grid == nullptr || this->grid->getVectorSpaceDimensions() != dimensions || this->lshHashFunction->getProjectionMatrix().getDimensions() != dimensions)
+        indexReader.invalidate();
+
+    std::vector<uint32_t> bucketSizes;
+    std::vector<uint32_t> hashValues;
+    std::vector<uint32_t> ids;
+    indexReader.readArray(bucketSizes);
+    indexReader.readArray(hashValues);
+    indexReader.readArray(ids);
+
+    uint64_t totalEntries = 0;
+    for (uint32_t bucketSize: bucketSizes)
+        totalEntries += bucketSize;
+
+    bool consistent = this->size > 0 && bucketSizes.size() == this->size && totalEntries == ids.size() && hashValues.size() == ids.size();
+    for (unsigned int i = 0; consistent && i < ids.size(); ++i)
+        if (ids[i] >= totalCurves)
+            consistent = false;
+
+    if (!consistent) {
+        indexReader.invalidate();
+        this->size = 1;
+        bucketSizes.assign(1, 0);
+    }
+
+    /* See README above */
+    this->buckets = new std::vector<std::pair<unsigned int, unsigned int>>[this->size];
+
+    unsigned int entry = 0;
+    for (unsigned int i = 0; i < this->size; ++i) {
+
+        this->buckets[i].reserve(bucketSizes[i]);
+
+        for (unsigned int j = 0; j < bucketSizes[i]; ++j, ++entry)
+            this->buckets[i].push_back(std::make_pair(hashValues[entry], ids[entry]));
+    }
 }
 
 CurveLSHTable::~CurveLSHTable() {
 
     delete this->grid;
     delete this->lshHashFunction;
-    /* In each bucket of the CurveLSHTable delete each stored vectorial representation of the corresponding Grid Curve */
-    for (unsigned int i = 0; i < this->size; ++i)
-        for (std::pair<unsigned int, Point *> pair: this->buckets[i])
-            delete pair.second;
-
     delete[] this->buckets;
 
 }
 
-std::pair<unsigned int, Point *> CurveLSHTable::hashCurve(Curve *curve) const {
+/* Function to write the hash table. The buckets are written as their sizes followed by all of their entries, grouped by bucket */
+void CurveLSHTable::save(IndexWriter &indexWriter) const {
+
+    indexWriter.writeValue<uint32_t>(this->id);
+    indexWriter.writeValue<uint32_t>(this->size);
+    this->lshHashFunction->save(indexWriter);
+    this->grid->save(indexWriter);
+
+    std::vector<uint32_t> bucketSizes;
+    std::vector<uint32_t> hashValues;
+    std::vector<uint32_t> ids;
+
+    for (unsigned int i = 0; i < this->size; ++i) {
+
+        bucketSizes.push_back(this->buckets[i].size());
+
+        for (const std::pair<unsigned int, unsigned int> &pair: this->buckets[i]) {
+            hashValues.push_back(pair.first);
+            ids.push_back(pair.second);
+        }
+    }
+
+    indexWriter.writeArray(bucketSizes);
+    indexWriter.writeArray(hashValues);
+    indexWriter.writeArray(ids);
+}
+
+unsigned int CurveLSHTable::hashCurve(Curve *curve) const {
 
     /* Get the vectorial representation V of a Curve's Grid Curve */
     Point *gridCurve = this->grid->snap(curve);
 
-    /* Return (V-amplified-hash-value, V)*/
-    return std::make_pair(this->lshHashFunction->hash(*gridCurve), gridCurve);
+    /* Calculate V's amplified hash value and delete V as it is no longer needed */
+    unsigned int amplifiedHashValue = this->lshHashFunction->hash(*gridCurve);
+    delete gridCurve;
+
+    return amplifiedHashValue;
 
 }
 
-void CurveLSHTable::insert(Curve *const curve) {
+void CurveLSHTable::insert(Curve *const curve, unsigned int id) {
 
-    /* Get the (V-amplified-hash-value, V) pair */
-    std::pair<unsigned int, Point *> hashPair = this->hashCurve(curve);
+    /* Get the V-amplified-hash-value */
+    unsigned int amplifiedHashValue = this->hashCurve(curve);
 
-    /* Insert the (V-amplified-hash value, V) pair in the corresponding bucket */
-    unsigned int position = Arithmetic::mod(hashPair.first, this->size);
-    this->buckets[position].push_back(std::make_pair(hashPair.first, hashPair.second));
+    /* Insert the (V-amplified-hash value, id) pair in the corresponding bucket */
+    unsigned int position = Arithmetic::mod(amplifiedHashValue, this->size);
+    this->buckets[position].push_back(std::make_pair(amplifiedHashValue, id));
 
 }
 
+/* Function to insert Curves in bulk with the consecutive ids firstId, firstId + 1, ... given their V-amplified-hash-values - see CurveLSHTable::hashCurve
+ * The Curves are sorted by bucket using a parallel counting sort and then each bucket is filled independently, using at most the given number of threads */
+void CurveLSHTable::insert(const std::vector<unsigned int> &amplifiedHashValues, unsigned int firstId, unsigned int threads) {
+
+    std::vector<unsigned int> positions(amplifiedHashValues.size());
+    for (unsigned int i = 0; i < amplifiedHashValues.size(); ++i)
+        positions[i] = Arithmetic::mod(amplifiedHashValues[i], this->size);
+
+    /* The Curves of bucket Y are order[offsets[Y]], ... , order[offsets[Y + 1] - 1] in insertion order */
+    std::vector<unsigned int> offsets;
+    std::vector<unsigned int> order;
+    Parallel::countingSort(positions, this->size, threads, offsets, order);
+
+    Parallel::parallelForBlocks(this->size, CurveLSHTable::BLOCK_SIZE, threads, [&](unsigned int first, unsigned int last) {
 
-std::vector<Curve *> *CurveLSHTable::getSimilarCurves(Curve *const curve, int threshold) {
+        for (unsigned int i = first; i < last; ++i) {
 
-    std::vector<Curve *> *similarCurves = new std::vector<Curve *>;
+            this->buckets[i].reserve(this->buckets[i].size() + offsets[i + 1] - offsets[i]);
 
-    /* Get the (QV-amplified-hash-value, QV) pair of the query Curve */
-    std::pair<unsigned int, Point *> queryPair = this->hashCurve(curve);
+            for (unsigned int j = offsets[i]; j < offsets[i + 1]; ++j)
+                this->buckets[i].push_back(std::make_pair(amplifiedHashValues[order[j]], firstId + order[j]));
+        }
+    });
+}
+
+/* Function to store the ids of the Curves that are similar to the given Curve in similarCurves, which is cleared first
+ * The caller provides the array so that it can be reused across hash tables */
+void CurveLSHTable::getSimilarCurves(Curve *const curve, int threshold, std::vector<unsigned int> &similarCurves) const {
+
+    similarCurves.clear();
+
+    /* Get the QV-amplified-hash-value of the query Curve */
+    unsigned int queryHashValue = this->hashCurve(curve);
 
     /* Calculate the bucket Y (QV-amplified-hash-value mod table-size) of the given query Curve */
-    unsigned int position = Arithmetic::mod(queryPair.first, this->size);
+    unsigned int position = Arithmetic::mod(queryHashValue, this->size);
 
-    /* For each pair (Vi-amplified-hash-value, Vi) in Y get the ones [(Vi)->getCurve()] that Vi-amplified-hash-value = QV-amplified-hash-value */
-    for (std::pair<unsigned int, Point *> pair: this->buckets[position])
-        if (pair.first == queryPair.first)
-            similarCurves->push_back(pair.second->getCurve());
+    /* For each pair (Vi-amplified-hash-value, idi) in Y get the ones (idi) that Vi-amplified-hash-value = QV-amplified-hash-value */
+    for (const std::pair<unsigned int, unsigned int> &pair: this->buckets[position])
+        if (pair.first == queryHashValue)
+            similarCurves.push_back(pair.second);
 
     /* If no Curves were found due to the fact that Y was not empty and no Vi-amplified-hash-value was equal to QV-amplified-hash-value */
-    if (similarCurves->empty() && !this->buckets[position].empty()) {
+    if (similarCurves.empty() && !this->buckets[position].empty()) {
 
         /* If the threshold defined in CurveLSH is equal to 0 get each available Curve */
         if (threshold == 0)
-            for (std::pair<unsigned int, Point *> pair: this->buckets[position])
-                similarCurves->push_back(pair.second->getCurve());
+            for (const std::pair<unsigned int, unsigned int> &pair: this->buckets[position])
+                similarCurves.push_back(pair.second);
 
             /* Otherwise, get as many Curves as possible */
         else
             for (unsigned int i = 0; i < this->buckets[position].size() && threshold > 0; ++i) {
-                similarCurves->push_back(this->buckets[position].at(i).second->getCurve());
+                similarCurves.push_back(this->buckets[position].at(i).second);
                 threshold--;
             }
     }
 
-
-    /* Delete QV as it is no longer needed */
-    delete queryPair.second;
-
-
-    return similarCurves;
-
 }
 
 unsigned int CurveLSHTable::getGridDimensions() const {
@@ -10,19 +10,24 @@
 class CurveLSHTable {
 
 private:
+    static const unsigned int BLOCK_SIZE;
+
     unsigned int id;
     unsigned int size;
     LSHHashFunction *lshHashFunction;
     Grid *grid;
-    /* Data structure to store the vectorial representation V of a Curve's Grid Curve alongside V's amplified hash value */
-    std::vector<std::pair<unsigned int, Point *>> *buckets;
-    std::pair<unsigned int, Point *> hashCurve(Curve *) const;
+    /* Data structure to store the id of a Curve - assigned by CurveLSH - alongside the amplified hash value of the vectorial representation V of the Curve's Grid Curve */
+    std::vector<std::pair<unsigned int, unsigned int>> *buckets;
 
 public:
-    CurveLSHTable(unsigned int, unsigned int, double, unsigned int, unsigned int, unsigned int, unsigned int, long double, bool);
+    CurveLSHTable(unsigned int, unsigned int, double, unsigned int, unsigned int, unsigned int, unsigned int, coordinate_t, bool);
+    CurveLSHTable(IndexReader &, unsigned int, unsigned int);
     virtual ~CurveLSHTable();
-    void insert(Curve *const);
-    std::vector<Curve *> *getSimilarCurves(Curve *const, int);
+    void save(IndexWriter &) const;
+    unsigned int hashCurve(Curve *) const;
+    void insert(Curve *const, unsigned int);
+    void insert(const std::vector<unsigned int> &, unsigned int, unsigned int);
+    void getSimilarCurves(Curve *const, int, std::vector<unsigned int> &) const;
     unsigned int getGridDimensions() const;
 };
 
@@ -1,8 +1,12 @@
-#include <unordered_map>
 #include <chrono>
 #include "CurveLSH.h"
+#include "../../../Utilities/Bounded-Heap/BoundedHeap.h"
+#include "../../../Utilities/Visited-Set/VisitedSet.h"
+#include "../../../Utilities/Parallel/Parallel.h"
 
-CurveLSH::CurveLSH(unsigned int dimensions, long double norm, unsigned int k, unsigned int w, unsigned int L, unsigned int hashTableSize, int threshold, unsigned int gridDimensions, long double delta, bool continuous) : CurveMethod(dimensions, norm, k, w) {
+const unsigned int CurveLSH::BLOCK_SIZE = 64;
+
+CurveLSH::CurveLSH(unsigned int dimensions, double norm, unsigned int k, unsigned int w, unsigned int L, unsigned int hashTableSize, int threshold, unsigned int gridDimensions, coordinate_t delta, bool continuous) : CurveMethod(dimensions, norm, k, w) {
 
     /* Create L hash tables */
     for (unsigned int i = 0; i < L; ++i)
@@ -15,37 +19,105 @@ CurveLSH::CurveLSH(unsigned int dimensions, long double norm, unsigned int k, un
         this->threshold = 0;
 }
 
+/* Constructor that reads the CurveLSH written by CurveLSH::save, given the dataset that its Curves were inserted from */
+CurveLSH::CurveLSH(IndexReader &indexReader, const std::vector<Curve *> &dataset) : CurveMethod(indexReader) {
+
+    this->threshold = indexReader.readValue<int32_t>();
+    CurveMethod::loadCurves(indexReader, dataset, this->curves);
+
+    uint32_t L = indexReader.readValue<uint32_t>();
+    for (unsigned int i = 0; i < L && indexReader.isValid(); ++i) {
+
+        this->curveLSHTables.push_back(new CurveLSHTable(indexReader, this->curves.size(), this->dimensions));
+
+        /* Every Grid should take Curves of the same dimensions as the first one, see CurveLSH::getGridDimensions */
+        if (indexReader.isValid() && this->curveLSHTables[i]->getGridDimensions() != this->curveLSHTables[0]->getGridDimensions())
+            indexReader.invalidate();
+    }
+
+    /* At least one hash table is needed, see CurveLSH::getGridDimensions */
+    if (this->curveLSHTables.empty())
+        indexReader.invalidate();
+}
+
 CurveLSH::~CurveLSH() {
 
     for (CurveLSHTable *curveLSHTable: this->curveLSHTables)
         delete curveLSHTable;
 }
 
+/* Function to write the CurveLSH, given the dataset that its Curves were inserted from */
+void CurveLSH::save(IndexWriter &indexWriter, const std::vector<Curve *> &dataset) const {
+
+    Method::save(indexWriter);
+    indexWriter.writeValue<int32_t>(this->threshold);
+    CurveMethod::saveCurves(indexWriter, this->curves, dataset);
+
+    indexWriter.writeValue<uint32_t>(this->curveLSHTables.size());
+    for (CurveLSHTable *curveLSHTable: this->curveLSHTables)
+        curveLSHTable->save(indexWriter);
+}
+
 void CurveLSH::insertCurve(Curve *const curve) {
 
     /* Insert the given Curve to the CurveLSH's |L| hash tables as long as :
      * (1) Grid's dimensions = Curve's dimensions
      * (2) Curve's complexity > 1 due to the fact that the provided Continuous Frechet Distance library only works for Curves of complexity of at least 2
      * (3) See README file - section CurveLSH */
-    if (curve->getDimensions() == this->getGridDimensions() && curve->getComplexity() > 1 && curve->getVectorialRepresentation()->getDimensions() <= this->dimensions)
+    if (curve->getDimensions() == this->getGridDimensions() && curve->getComplexity() > 1 && curve->getVectorialRepresentation()->getDimensions() <= this->dimensions) {
+
+        unsigned int id = this->curves.size();
+        this->curves.push_back(curve);
+
         for (unsigned int i = 0; i < this->curveLSHTables.size(); ++i)
-            this->curveLSHTables[i]->insert(curve);
+            this->curveLSHTables[i]->insert(curve, id);
+    }
 }
 
-std::tuple<Curve *, long double, double> CurveLSH::getApproximateNearestNeighbor(Curve *const queryCurve, CurveMetric *curveMetric) {
+/* Function to insert the given Curves in bulk using at most the given number of threads
+ * The Curves are snapped and hashed in parallel for each of the |L| hash tables and then each hash table is filled once */
+void CurveLSH::build(const std::vector<Curve *> &curves, unsigned int threads) {
+
+    /* See CurveLSH::insertCurve */
+    std::vector<Curve *> validCurves;
+    for (Curve *curve: curves)
+        if (curve->getDimensions() == this->getGridDimensions() && curve->getComplexity() > 1 && curve->getVectorialRepresentation()->getDimensions() <= this->dimensions)
+            validCurves.push_back(curve);
+
+    unsigned int firstId = this->curves.size();
+    this->curves.insert(this->curves.end(), validCurves.begin(), validCurves.end());
+
+    /* The V-amplified-hash-values of the given Curves in each hash table */
+    std::vector<std::vector<unsigned int>> amplifiedHashValues(this->curveLSHTables.size(), std::vector<unsigned int>(validCurves.size()));
+
+    Parallel::parallelForBlocks(validCurves.size(), CurveLSH::BLOCK_SIZE, threads, [&](unsigned int first, unsigned int last) {
+        for (unsigned int i = first; i < last; ++i)
+            for (unsigned int j = 0; j < this->curveLSHTables.size(); ++j)
+                amplifiedHashValues[j][i] = this->curveLSHTables[j]->hashCurve(validCurves[i]);
+    });
+
+    for (unsigned int i = 0; i < this->curveLSHTables.size(); ++i)
+        this->curveLSHTables[i]->insert(amplifiedHashValues[i], firstId, threads);
+}
+
+std::tuple<Curve *, distance_t, double> CurveLSH::getApproximateNearestNeighbor(Curve *const queryCurve, CurveMetric *curveMetric) {
 
     if (queryCurve->getDimensions() == this->getGridDimensions() && queryCurve->getComplexity() > 1 && queryCurve->getVectorialRepresentation()->getDimensions() <= this->dimensions) {
 
-        /* Data structure to check if a Curve has already been examined */
-        std::unordered_map<Curve *, bool> curvesConsidered;
+        /* Data structure to check if a Curve has already been examined, which is kept per thread and indexed by the Curves' ids */
+        thread_local VisitedSet curvesConsidered;
+        curvesConsidered.clear(this->curves.size());
 
         int totalCurvesConsidered = 0;
-        long double minDistance = std::numeric_limits<long double>::max();
+        distance_t minDistance = std::numeric_limits<distance_t>::max();
         Curve *nearestNeighbor = nullptr;
 
         /* Start the clock */
         std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
 
+        /* Array that is reused by every hash table to store the ids of its similar Curves */
+        std::vector<unsigned int> similarCurves;
+
         for (CurveLSHTable *curveLSHTable: this->curveLSHTables) {
 
 
@@ -61,20 +133,22 @@ std::tuple<Curve *, long double, double> CurveLSH::getApproximateNearestNeighbor
             else
                 curvesToGet = 1;
 
-            std::vector<Curve *> *similarCurves = curveLSHTable->getSimilarCurves(queryCurve, curvesToGet);
+            curveLSHTable->getSimilarCurves(queryCurve, curvesToGet, similarCurves);
 
-            for (Curve *similarCurve: *similarCurves) {
+            for (unsigned int similarCurveId: similarCurves) {
 
                 /* Check if the similar Curve has already been examined  */
-                if (curvesConsidered.find(similarCurve) == curvesConsidered.end()) {
+                if (curvesConsidered.visit(similarCurveId)) {
+
+                    Curve *similarCurve = this->curves[similarCurveId];
 
-                    long double distanceToQueryCurve = curveMetric->distance(*queryCurve, *similarCurve);
+                    /* A Curve farther than the current nearest neighbor is rejected as soon as possible */
+                    distance_t distanceToQueryCurve = curveMetric->boundedDistance(*queryCurve, *similarCurve, minDistance);
                     if (distanceToQueryCurve < minDistance) {
                         minDistance = distanceToQueryCurve;
                         nearestNeighbor = similarCurve;
                     }
 
-                    curvesConsidered[similarCurve] = true;
                     totalCurvesConsidered++;
 
 
@@ -83,8 +157,6 @@ std::tuple<Curve *, long double, double> CurveLSH::getApproximateNearestNeighbor
                 }
 
             }
-
-            delete similarCurves;
         }
 
         /* Stop the clock */
@@ -99,17 +171,22 @@ std::tuple<Curve *, long double, double> CurveLSH::getApproximateNearestNeighbor
 
 }
 
-std::vector<Curve *> *CurveLSH::rangeSearch(Curve *const queryCurve, long double R, CurveMetric *curveMetric) {
+std::vector<Curve *> *CurveLSH::rangeSearch(Curve *const queryCurve, distance_t R, CurveMetric *curveMetric) {
 
 
     std::vector<Curve *> *rangeSearchNeighbors = new std::vector<Curve *>;
 
     if (queryCurve->getDimensions() == this->getGridDimensions() && queryCurve->getComplexity() > 1 && queryCurve->getVectorialRepresentation()->getDimensions() <= this->dimensions) {
 
-        std::unordered_map<Curve *, bool> curvesConsidered;
+        /* Data structure to check if a Curve has already been examined, which is kept per thread and indexed by the Curves' ids */
+        thread_local VisitedSet curvesConsidered;
+        curvesConsidered.clear(this->curves.size());
 
         int totalCurvesConsidered = 0;
 
+        /* Array that is reused by every hash table to store the ids of its similar Curves */
+        std::vector<unsigned int> similarCurves;
+
         for (CurveLSHTable *curveLSHTable: this->curveLSHTables) {
 
             if (this->threshold > 0 && totalCurvesConsidered >= this->threshold)
@@ -124,19 +201,19 @@ std::vector<Curve *> *CurveLSH::rangeSearch(Curve *const queryCurve, long double
             else
                 curvesToGet = 1;
 
-            std::vector<Curve *> *similarCurves = curveLSHTable->getSimilarCurves(queryCurve, curvesToGet);
+            curveLSHTable->getSimilarCurves(queryCurve, curvesToGet, similarCurves);
 
-            for (Curve *similarCurve: *similarCurves) {
+            for (unsigned int similarCurveId: similarCurves) {
 
                 /* Check if the similar Curve has already been considered */
-                if (curvesConsidered.find(similarCurve) == curvesConsidered.end()) {
+                if (curvesConsidered.visit(similarCurveId)) {
 
-                    long double distance = curveMetric->distance(*queryCurve, *similarCurve);
+                    Curve *similarCurve = this->curves[similarCurveId];
 
-                    if (distance <= R)
+                    /* Only whether the distance exceeds R matters, not the distance itself */
+                    if (curveMetric->isWithin(*queryCurve, *similarCurve, R))
                         rangeSearchNeighbors->push_back(similarCurve);
 
-                    curvesConsidered[similarCurve] = true;
                     totalCurvesConsidered++;
 
 
@@ -146,8 +223,6 @@ std::vector<Curve *> *CurveLSH::rangeSearch(Curve *const queryCurve, long double
                 }
 
             }
-
-            delete similarCurves;
         }
 
     }
@@ -155,6 +230,59 @@ std::vector<Curve *> *CurveLSH::rangeSearch(Curve *const queryCurve, long double
     return rangeSearchNeighbors;
 }
 
+/* Function to get the (at most) k approximate nearest neighbors given a Curve metric, sorted in ascending order of their distances */
+std::vector<std::pair<Curve *, distance_t>> *CurveLSH::getKNearestNeighbors(Curve *const queryCurve, unsigned int k, CurveMetric *curveMetric) {
+
+    BoundedHeap<Curve *> nearestNeighbors(k);
+
+    if (queryCurve->getDimensions() == this->getGridDimensions() && queryCurve->getComplexity() > 1 && queryCurve->getVectorialRepresentation()->getDimensions() <= this->dimensions) {
+
+        /* Data structure to check if a Curve has already been examined, which is kept per thread and indexed by the Curves' ids */
+        thread_local VisitedSet curvesConsidered;
+        curvesConsidered.clear(this->curves.size());
+
+        int totalCurvesConsidered = 0;
+
+        /* Array that is reused by every hash table to store the ids of its similar Curves */
+        std::vector<unsigned int> similarCurves;
+
+        for (CurveLSHTable *curveLSHTable: this->curveLSHTables) {
+
+            if (this->threshold > 0 && totalCurvesConsidered >= this->threshold)
+                break;
+
+            /* See CurveLSHTable::getSimilarCurves for more */
+            int curvesToGet;
+            if (this->threshold == 0)
+                curvesToGet = 0;
+            else if ((this->threshold / this->curveLSHTables.size()) > 0)
+                curvesToGet = this->threshold / this->curveLSHTables.size();
+            else
+                curvesToGet = 1;
+
+            curveLSHTable->getSimilarCurves(queryCurve, curvesToGet, similarCurves);
+
+            for (unsigned int similarCurveId: similarCurves) {
+
+                /* Check if the similar Curve has already been examined  */
+                if (curvesConsidered.visit(similarCurveId)) {
+
+                    Curve *similarCurve = this->curves[similarCurveId];
+
+                    nearestNeighbors.push(similarCurve, curveMetric->boundedDistance(*queryCurve, *similarCurve, nearestNeighbors.getWorstDistance()));
+
+                    totalCurvesConsidered++;
+
+                    if (this->threshold > 0 && totalCurvesConsidered >= this->threshold)
+                        break;
+                }
+            }
+        }
+    }
+
+    return nearestNeighbors.toSortedVector();
+}
+
 unsigned int CurveLSH::getGridDimensions() const {
     return this->curveLSHTables[0]->getGridDimensions();
 }
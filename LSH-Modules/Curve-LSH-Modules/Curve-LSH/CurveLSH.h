@@ -8,15 +8,23 @@
 class CurveLSH : public CurveMethod {
 
 private:
+    static const unsigned int BLOCK_SIZE;
+
     std::vector<CurveLSHTable *> curveLSHTables;
+    /* The inserted Curves in insertion order, thus a Curve's id is its position */
+    std::vector<Curve *> curves;
     int threshold;
 
 public:
-    CurveLSH(unsigned int, long double, unsigned int, unsigned int, unsigned int, unsigned int, int, unsigned int, long double, bool);
+    CurveLSH(unsigned int, double, unsigned int, unsigned int, unsigned int, unsigned int, int, unsigned int, coordinate_t, bool);
+    CurveLSH(IndexReader &, const std::vector<Curve *> &);
     virtual ~CurveLSH();
+    void save(IndexWriter &, const std::vector<Curve *> &) const;
     void insertCurve(Curve *const curve);
-    virtual std::tuple<Curve *, long double, double> getApproximateNearestNeighbor(Curve *const, CurveMetric *);
-    virtual std::vector<Curve *> *rangeSearch(Curve *const, long double, CurveMetric *);
+    void build(const std::vector<Curve *> &, unsigned int);
+    virtual std::tuple<Curve *, distance_t, double> getApproximateNearestNeighbor(Curve *const, CurveMetric *);
+    virtual std::vector<Curve *> *rangeSearch(Curve *const, distance_t, CurveMetric *);
+    virtual std::vector<std::pair<Curve *, distance_t>> *getKNearestNeighbors(Curve *const, unsigned int, CurveMetric *);
     unsigned int getGridDimensions() const;
 };
 
@@ -2,7 +2,7 @@
 #include "Grid.h"
 #include "../../../Utilities/Random/Random.h"
 
-const long double Grid::LARGE_PADDING_NUMBER = 10000.0;
+const coordinate_t Grid::LARGE_PADDING_NUMBER = 10000.0;
 
 /* ----
  *
@@ -15,7 +15,7 @@ const long double Grid::LARGE_PADDING_NUMBER = 10000.0;
 
 
 /* Utility/Guard function to make sure that only a 1/2-dimensional continuous Grid can be created and an X-dimensional discrete Grid can be created where X > 0 */
-Grid *Grid::createGrid(unsigned int vectorSpaceDimensions, unsigned int dimensions, long double delta, bool continuous) {
+Grid *Grid::createGrid(unsigned int vectorSpaceDimensions, unsigned int dimensions, coordinate_t delta, bool continuous) {
 
     if (dimensions == 0 || delta <= 0 || vectorSpaceDimensions == 0)
         return nullptr;
@@ -27,7 +27,33 @@ Grid *Grid::createGrid(unsigned int vectorSpaceDimensions, unsigned int dimensio
 }
 
 
-Grid::Grid(unsigned int vectorSpaceDimensions, unsigned int dimensions, long double delta, bool continuous) {
+/* Utility/Guard function to read the Grid written by Grid::save, which returns nullptr and invalidates the IndexReader in case the Grid could not have been created */
+Grid *Grid::createGrid(IndexReader &indexReader) {
+
+    unsigned int vectorSpaceDimensions = indexReader.readValue<uint32_t>();
+    unsigned int dimensions = indexReader.readValue<uint32_t>();
+    coordinate_t delta = indexReader.readValue<coordinate_t>();
+    bool continuous = indexReader.readValue<uint8_t>() != 0;
+
+    std::vector<coordinate_t> t;
+    indexReader.readArray(t);
+
+    Grid *grid = Grid::createGrid(vectorSpaceDimensions, dimensions, delta, continuous);
+
+    if (grid == nullptr || t.size() != dimensions) {
+        indexReader.invalidate();
+        delete grid;
+        return nullptr;
+    }
+
+    /* The random shift t is replaced by the stored one */
+    delete grid->t;
+    grid->t = new Vector(t);
+
+    return grid;
+}
+
+Grid::Grid(unsigned int vectorSpaceDimensions, unsigned int dimensions, coordinate_t delta, bool continuous) {
 
 
     this->delta = delta;
@@ -39,9 +65,18 @@ Grid::Grid(unsigned int vectorSpaceDimensions, unsigned int dimensions, long dou
 
 Grid::~Grid() { delete this->t; }
 
+void Grid::save(IndexWriter &indexWriter) const {
+
+    indexWriter.writeValue<uint32_t>(this->vectorSpaceDimensions);
+    indexWriter.writeValue<uint32_t>(this->dimensions);
+    indexWriter.writeValue<coordinate_t>(this->delta);
+    indexWriter.writeValue<uint8_t>(this->continuous);
+    indexWriter.writeArray(this->t->getCoordinates(), this->t->getDimensions());
+}
+
 void Grid::createT() {
 
-    std::vector<long double> coordinates;
+    std::vector<coordinate_t> coordinates;
 
     for (unsigned int i = 0; i < this->dimensions; ++i)
         coordinates.push_back(Random::randomLongDouble(0.0, this->delta));
@@ -63,10 +98,10 @@ Point *Grid::snap(Curve *curve) const {
         /* Map each X-dimensional Vector/Point of the given Curve to the corresponding mapping */
         for (Vector *vector: curve->getPoints()) {
 
-            std::vector<long double> coordinates;
+            std::vector<coordinate_t> coordinates;
 
             for (unsigned int i = 0; i < vector->getDimensions(); ++i) {
-                long double ai = std::round((vector->getCoordinates()[i] - this->t->getCoordinates()[i]) / this->delta);
+                coordinate_t ai = std::round((vector->getCoordinates()[i] - this->t->getCoordinates()[i]) / this->delta);
                 coordinates.push_back((ai * this->delta) + this->t->getCoordinates()[i]);
             }
 
@@ -82,10 +117,10 @@ Point *Grid::snap(Curve *curve) const {
             }
 
         /* Create the vectorial representation of the Grid Curve */
-        std::vector<long double> coordinates;
+        std::vector<coordinate_t> coordinates;
         for (Vector *vector: gridCurve) {
-            for (long double coordinate: vector->getCoordinates())
-                coordinates.push_back(coordinate);
+            for (unsigned int i = 0; i < vector->getDimensions(); ++i)
+                coordinates.push_back(vector->getCoordinates()[i]);
             delete vector;
         }
 
@@ -111,10 +146,10 @@ Point *Grid::snap(Curve *curve) const {
         /* Map each 1/2-dimensional Vector/Point of the given Curve to the corresponding mapping */
         for (Vector *vector: curve->getPoints()) {
 
-            std::vector<long double> coordinates;
+            std::vector<coordinate_t> coordinates;
 
             for (unsigned int i = 0; i < vector->getDimensions(); ++i) {
-                long double mapping = std::floor((vector->getCoordinates()[i] + this->t->getCoordinates()[i]) / this->delta) * this->delta;
+                coordinate_t mapping = std::floor((vector->getCoordinates()[i] + this->t->getCoordinates()[i]) / this->delta) * this->delta;
                 coordinates.push_back(mapping);
             }
 
@@ -129,9 +164,9 @@ Point *Grid::snap(Curve *curve) const {
             if (i + 1 >= gridCurve.size())
                 break;
 
-            long double previous = gridCurve[i - 1]->getCoordinates()[this->dimensions - 1];
-            long double current = gridCurve[i]->getCoordinates()[this->dimensions - 1];
-            long double next = gridCurve[i + 1]->getCoordinates()[this->dimensions - 1];
+            coordinate_t previous = gridCurve[i - 1]->getCoordinates()[this->dimensions - 1];
+            coordinate_t current = gridCurve[i]->getCoordinates()[this->dimensions - 1];
+            coordinate_t next = gridCurve[i + 1]->getCoordinates()[this->dimensions - 1];
 
             if (current <= std::max(previous, next) && current >= std::min(previous, next)) {
                 delete gridCurve[i];
@@ -153,10 +188,10 @@ Point *Grid::snap(Curve *curve) const {
 
 
         /* Create the vectorial representation of the Grid Curve */
-        std::vector<long double> coordinates;
+        std::vector<coordinate_t> coordinates;
         for (Vector *vector: gridCurve) {
-            for (long double coordinate: vector->getCoordinates())
-                coordinates.push_back(coordinate);
+            for (unsigned int i = 0; i < vector->getDimensions(); ++i)
+                coordinates.push_back(vector->getCoordinates()[i]);
             delete vector;
         }
 
@@ -177,4 +212,8 @@ unsigned int Grid::getDimensions() const {
     return this->dimensions;
 }
 
+unsigned int Grid::getVectorSpaceDimensions() const {
+    return this->vectorSpaceDimensions;
+}
+
 
@@ -3,24 +3,29 @@
 
 
 #include "../../../Curve-Modules/Curve/Curve.h"
+#include "../../../Utilities/Index-Writer/IndexWriter.h"
+#include "../../../Utilities/Index-Reader/IndexReader.h"
 
 class Grid {
 
 private:
-    static const long double LARGE_PADDING_NUMBER;
+    static const coordinate_t LARGE_PADDING_NUMBER;
     bool continuous;
     Vector *t;
-    long double delta;
+    coordinate_t delta;
     unsigned int dimensions;
     unsigned int vectorSpaceDimensions;
     void createT();
-    Grid(unsigned int, unsigned int, long double, bool);
+    Grid(unsigned int, unsigned int, coordinate_t, bool);
 
 public:
-    static Grid *createGrid(unsigned int, unsigned int, long double, bool);
+    static Grid *createGrid(unsigned int, unsigned int, coordinate_t, bool);
+    static Grid *createGrid(IndexReader &);
     ~Grid();
+    void save(IndexWriter &) const;
     Point *snap(Curve *curve) const;
     unsigned int getDimensions() const;
+    unsigned int getVectorSpaceDimensions() const;
 };
 
 
@@ -13,13 +13,26 @@ LSHFunction::~LSHFunction() {
     delete this->unitVector;
 }
 
-long long int LSHFunction::hash(const Point &point) const {
+/* Utility function to calculate the position of the given Point on the LSHFunction's line in units of the window
+ * Its integer part is the Point's bucket/index and its fractional part is the Point's offset within the bucket */
+coordinate_t LSHFunction::project(const Point &point) const {
 
     /* Calculate the <Point,unitVector> and add the LSHFunction's shift to it */
-    long double numerator = (*this->unitVector * (Vector &) point) + (long double) this->shift;
+    coordinate_t numerator = (*this->unitVector * (Vector &) point) + (coordinate_t) this->shift;
+
+    return numerator / (coordinate_t) this->window;
+}
+
+long long int LSHFunction::hash(const Point &point) const {
 
     /* Calculate the corresponding bucket/index and return it */
-    return (long long int) floorl(numerator / (long double) this->window);
+    return (long long int) std::floor(this->project(point));
 }
 
+const Vector &LSHFunction::getUnitVector() const {
+    return *this->unitVector;
+}
 
+float LSHFunction::getShift() const {
+    return this->shift;
+}
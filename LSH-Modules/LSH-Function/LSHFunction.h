@@ -16,7 +16,10 @@ private:
 public:
     LSHFunction(unsigned int, double, unsigned int);
     ~LSHFunction();
+    coordinate_t project(const Point&) const;
     long long int hash(const Point&) const;
+    const Vector &getUnitVector() const;
+    float getShift() const;
 
 };
 
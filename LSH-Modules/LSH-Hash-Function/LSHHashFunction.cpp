@@ -1,4 +1,7 @@
 #include <limits>
+#include <cmath>
+#include <vector>
+#include <algorithm>
 #include "LSHHashFunction.h"
 #include "../../Utilities/Random/Random.h"
 #include "../../Utilities/Arithmetic/Arithmetic.h"
@@ -14,32 +17,138 @@ LSHHashFunction::LSHHashFunction(unsigned int dimensions, double norm, unsigned
     for (unsigned int i = 0; i < k; ++i)
         this->weights[i] = Random::randomInteger(1, (std::numeric_limits<int>::max() / 2));
 
-    /* Create k LSHFunctions */
-    this->lshFunctions = new LSHFunction *[k];
+    /* Create k LSHFunctions and pack them in the rows of a ProjectionMatrix */
+    this->projectionMatrix = new ProjectionMatrix(k, dimensions, window);
+    for (unsigned int i = 0; i < k; ++i) {
+        LSHFunction lshFunction(dimensions, norm, window);
+        this->projectionMatrix->setRow(i, lshFunction);
+    }
+
+}
+
+/* Constructor that packs the k LSHFunctions in the rows [firstRow, firstRow + k) of the given ProjectionMatrix - which is shared with other LSHHashFunctions - instead of a ProjectionMatrix of its own */
+LSHHashFunction::LSHHashFunction(ProjectionMatrix &projectionMatrix, unsigned int firstRow, double norm, unsigned int k) {
+
+    this->k = k;
+
+    this->weights = new int[k];
     for (unsigned int i = 0; i < k; ++i)
-        this->lshFunctions[i] = new LSHFunction(dimensions, norm, window);
+        this->weights[i] = Random::randomInteger(1, (std::numeric_limits<int>::max() / 2));
 
+    this->projectionMatrix = new ProjectionMatrix(projectionMatrix, firstRow, k);
+    for (unsigned int i = 0; i < k; ++i) {
+        LSHFunction lshFunction(projectionMatrix.getDimensions(), norm, projectionMatrix.getWindow());
+        this->projectionMatrix->setRow(i, lshFunction);
+    }
 }
 
-LSHHashFunction::~LSHHashFunction() {
+/* Constructor that reads the LSHHashFunction written by LSHHashFunction::save */
+LSHHashFunction::LSHHashFunction(IndexReader &indexReader) {
 
-    for (unsigned int i = 0; i < this->k; ++i)
-        delete this->lshFunctions[i];
+    std::vector<int> weights;
+    indexReader.readArray(weights);
 
-    delete[] this->lshFunctions;
+    this->k = weights.size();
+    this->weights = new int[this->k];
+    std::copy(weights.begin(), weights.end(), this->weights);
+
+    this->projectionMatrix = new ProjectionMatrix(indexReader);
+
+    /* Each weight corresponds to a row of the ProjectionMatrix */
+    if (this->projectionMatrix->getRows() != this->k)
+        indexReader.invalidate();
+}
+
+LSHHashFunction::~LSHHashFunction() {
+
+    delete this->projectionMatrix;
     delete[] this->weights;
 }
 
+void LSHHashFunction::save(IndexWriter &indexWriter) const {
+
+    indexWriter.writeArray(this->weights, this->k);
+    this->projectionMatrix->save(indexWriter);
+}
+
+/* Function to replace the LSHHashFunction's ProjectionMatrix with a view of the rows [firstRow, firstRow + k) of the given ProjectionMatrix, which should be identical to the current ones */
+void LSHHashFunction::shareProjectionMatrix(ProjectionMatrix &projectionMatrix, unsigned int firstRow) {
+
+    delete this->projectionMatrix;
+    this->projectionMatrix = new ProjectionMatrix(projectionMatrix, firstRow, this->k);
+}
+
 /* The following implementation is based on the fact that : (x+y) mod A == [(x mod A) + (y mod A)] mod A  to prevent potential overflows */
-unsigned int LSHHashFunction::hash(const Point &point) {
+unsigned int LSHHashFunction::hash(const Point &point) const {
+
+    /* The array is kept per thread, so that it is only allocated once */
+    thread_local std::vector<coordinate_t> positions;
+    positions.resize(this->k);
+
+    this->projectionMatrix->project(point, positions.data());
+
+    return this->hash(positions.data());
+}
+
+/* Utility function to calculate the amplified hash value of the given Point, which also stores the k h_i() values in slots
+ * and the Point's offset within each h_i() bucket in offsets. Both arrays should be of size k */
+unsigned int LSHHashFunction::hash(const Point &point, long long int *slots, coordinate_t *offsets) const {
+
+    thread_local std::vector<coordinate_t> positions;
+    positions.resize(this->k);
+
+    this->projectionMatrix->project(point, positions.data());
+
+    return this->hash(positions.data(), slots, offsets);
+}
+
+/* Utility function to calculate the amplified hash value given the positions of a Point on the lines of the k h_i() functions - see ProjectionMatrix::project */
+unsigned int LSHHashFunction::hash(const coordinate_t *positions) const {
 
     /* Calculate the amplified hash value of the given Point */
     long long int amplifiedHashValue = 0;
     for (unsigned int i = 0; i < this->k; ++i)
-        amplifiedHashValue += Arithmetic::mod(this->weights[i] * this->lshFunctions[i]->hash(point), LSHHashFunction::PRIME);
+        amplifiedHashValue += Arithmetic::mod(this->weights[i] * (long long int) std::floor(positions[i]), LSHHashFunction::PRIME);
 
     /* Return (amplified hash value mod 4294967291) */
     return (unsigned int) Arithmetic::mod(amplifiedHashValue, LSHHashFunction::PRIME);
 }
 
+/* Same as above, which also stores the k h_i() values in slots and the Point's offset within each h_i() bucket in offsets */
+unsigned int LSHHashFunction::hash(const coordinate_t *positions, long long int *slots, coordinate_t *offsets) const {
+
+    for (unsigned int i = 0; i < this->k; ++i) {
+        slots[i] = (long long int) std::floor(positions[i]);
+        offsets[i] = positions[i] - std::floor(positions[i]);
+    }
+
+    return this->combine(slots);
+}
+
+/* Utility function to calculate the amplified hash value given the k h_i() values */
+unsigned int LSHHashFunction::combine(const long long int *slots) const {
+
+    long long int amplifiedHashValue = 0;
+    for (unsigned int i = 0; i < this->k; ++i)
+        amplifiedHashValue += Arithmetic::mod(this->weights[i] * slots[i], LSHHashFunction::PRIME);
+
+    return (unsigned int) Arithmetic::mod(amplifiedHashValue, LSHHashFunction::PRIME);
+}
+
+/* Utility function to calculate the amplified hash value that results from replacing the ith h_i() value, equal to slot, with slot + delta
+ * Only the ith term of the sum changes, thus it is replaced in O(1) instead of recalculating the whole sum */
+unsigned int LSHHashFunction::perturb(unsigned int amplifiedHashValue, unsigned int i, long long int slot, int delta) const {
 
+    long long int previousTerm = Arithmetic::mod(this->weights[i] * slot, LSHHashFunction::PRIME);
+    long long int nextTerm = Arithmetic::mod(this->weights[i] * (slot + delta), LSHHashFunction::PRIME);
+
+    return (unsigned int) Arithmetic::mod((long long int) amplifiedHashValue - previousTerm + nextTerm, LSHHashFunction::PRIME);
+}
+
+unsigned int LSHHashFunction::getK() const {
+    return this->k;
+}
+
+const ProjectionMatrix &LSHHashFunction::getProjectionMatrix() const {
+    return *this->projectionMatrix;
+}
@@ -3,6 +3,7 @@
 
 
 #include "../LSH-Function/LSHFunction.h"
+#include "../Projection-Matrix/ProjectionMatrix.h"
 
 class LSHHashFunction {
 
@@ -10,12 +11,24 @@ private:
     const static unsigned int PRIME;
     unsigned int k;
     int *weights;
-    LSHFunction **lshFunctions;
+    /* The unit vectors and shifts of the k h_i() functions */
+    ProjectionMatrix *projectionMatrix;
 
 public:
     LSHHashFunction(unsigned int, double, unsigned int, unsigned int);
+    LSHHashFunction(ProjectionMatrix &, unsigned int, double, unsigned int);
+    explicit LSHHashFunction(IndexReader &);
     ~LSHHashFunction();
-    unsigned int hash(const Point &);
+    void save(IndexWriter &) const;
+    void shareProjectionMatrix(ProjectionMatrix &, unsigned int);
+    unsigned int hash(const Point &) const;
+    unsigned int hash(const Point &, long long int *, coordinate_t *) const;
+    unsigned int hash(const coordinate_t *) const;
+    unsigned int hash(const coordinate_t *, long long int *, coordinate_t *) const;
+    unsigned int combine(const long long int *) const;
+    unsigned int perturb(unsigned int, unsigned int, long long int, int) const;
+    unsigned int getK() const;
+    const ProjectionMatrix &getProjectionMatrix() const;
 };
 
 
@@ -0,0 +1,129 @@
+#include <cstring>
+#include "ProjectionMatrix.h"
+#include "../../Metric-Modules/Distance-Kernels/DistanceKernels.h"
+
+ProjectionMatrix::ProjectionMatrix(unsigned int rows, unsigned int dimensions, unsigned int window) {
+
+    this->rows = rows;
+    this->dimensions = dimensions;
+    this->window = window;
+    this->unitVectors = new coordinate_t[(unsigned long int) rows * dimensions]();
+    this->shifts = new coordinate_t[rows]();
+    this->ownsRows = true;
+}
+
+/* Constructor of a view of the given number of rows of the given ProjectionMatrix starting from firstRow
+ * The view shares the rows of the given ProjectionMatrix - thus ProjectionMatrix::setRow writes to them - and should not outlive it */
+ProjectionMatrix::ProjectionMatrix(ProjectionMatrix &projectionMatrix, unsigned int firstRow, unsigned int rows) {
+
+    this->rows = rows;
+    this->dimensions = projectionMatrix.dimensions;
+    this->window = projectionMatrix.window;
+    this->unitVectors = projectionMatrix.unitVectors + (unsigned long int) firstRow * this->dimensions;
+    this->shifts = projectionMatrix.shifts + firstRow;
+    this->ownsRows = false;
+}
+
+/* Utility/Guard function to stack the rows of the given ProjectionMatrices in the given order, which returns nullptr in case they do not share the same dimensions and window */
+ProjectionMatrix *ProjectionMatrix::createProjectionMatrix(const std::vector<const ProjectionMatrix *> &projectionMatrices) {
+
+    for (const ProjectionMatrix *projectionMatrix: projectionMatrices)
+        if (projectionMatrix->dimensions != projectionMatrices[0]->dimensions || projectionMatrix->window != projectionMatrices[0]->window)
+            return nullptr;
+
+    return new ProjectionMatrix(projectionMatrices);
+}
+
+/* Constructor that stacks the rows of the given ProjectionMatrices, see ProjectionMatrix::createProjectionMatrix */
+ProjectionMatrix::ProjectionMatrix(const std::vector<const ProjectionMatrix *> &projectionMatrices) {
+
+    this->rows = 0;
+    for (const ProjectionMatrix *projectionMatrix: projectionMatrices)
+        this->rows += projectionMatrix->rows;
+
+    this->dimensions = projectionMatrices.empty() ? 0 : projectionMatrices[0]->dimensions;
+    this->window = projectionMatrices.empty() ? 1 : projectionMatrices[0]->window;
+    this->unitVectors = new coordinate_t[(unsigned long int) this->rows * this->dimensions];
+    this->shifts = new coordinate_t[this->rows];
+    this->ownsRows = true;
+
+    unsigned int row = 0;
+    for (const ProjectionMatrix *projectionMatrix: projectionMatrices) {
+        std::memcpy(this->unitVectors + (unsigned long int) row * this->dimensions, projectionMatrix->unitVectors, sizeof(coordinate_t) * projectionMatrix->rows * this->dimensions);
+        std::memcpy(this->shifts + row, projectionMatrix->shifts, sizeof(coordinate_t) * projectionMatrix->rows);
+        row += projectionMatrix->rows;
+    }
+}
+
+/* Constructor that reads the ProjectionMatrix written by ProjectionMatrix::save */
+ProjectionMatrix::ProjectionMatrix(IndexReader &indexReader) {
+
+    this->rows = indexReader.readValue<uint32_t>();
+    this->dimensions = indexReader.readValue<uint32_t>();
+    this->window = indexReader.readValue<uint32_t>();
+
+    /* The size of the matrix is checked before the allocation, so that a corrupted size does not lead to a huge one */
+    if (!indexReader.hasRemainingValues<coordinate_t>((uint64_t) this->rows * this->dimensions + this->rows)) {
+        this->rows = 0;
+        this->dimensions = 0;
+    }
+
+    this->unitVectors = new coordinate_t[(unsigned long int) this->rows * this->dimensions]();
+    this->shifts = new coordinate_t[this->rows]();
+    this->ownsRows = true;
+    indexReader.readArray(this->unitVectors, (uint64_t) this->rows * this->dimensions);
+    indexReader.readArray(this->shifts, this->rows);
+}
+
+ProjectionMatrix::~ProjectionMatrix() {
+
+    if (this->ownsRows) {
+        delete[] this->unitVectors;
+        delete[] this->shifts;
+    }
+}
+
+void ProjectionMatrix::save(IndexWriter &indexWriter) const {
+
+    indexWriter.writeValue<uint32_t>(this->rows);
+    indexWriter.writeValue<uint32_t>(this->dimensions);
+    indexWriter.writeValue<uint32_t>(this->window);
+    indexWriter.writeArray(this->unitVectors, (uint64_t) this->rows * this->dimensions);
+    indexWriter.writeArray(this->shifts, this->rows);
+}
+
+/* Utility function to store the unit vector and the shift of the given h_i() function in the ith row */
+void ProjectionMatrix::setRow(unsigned int i, const LSHFunction &lshFunction) {
+
+    std::memcpy(this->unitVectors + (unsigned long int) i * this->dimensions, lshFunction.getUnitVector().getCoordinates(), sizeof(coordinate_t) * this->dimensions);
+    this->shifts[i] = (coordinate_t) lshFunction.getShift();
+}
+
+/* Function to store the position of the given Point on the line of each row's h_i() function in positions, which should be of size rows
+ * The ith position is equal to the one LSHFunction::project would return for the ith row's h_i() function */
+void ProjectionMatrix::project(const Point &point, coordinate_t *positions) const {
+
+    /* The array is kept per thread, so that it is only allocated once */
+    thread_local std::vector<distance_t> innerProducts;
+    innerProducts.resize(this->rows);
+
+    if (point.getDimensions() == this->dimensions)
+        DistanceKernels::innerProducts(this->unitVectors, this->rows, point.getCoordinates(), this->dimensions, innerProducts.data());
+    else
+        innerProducts.assign(this->rows, Vector::INVALID_PARAMETERS);
+
+    for (unsigned int i = 0; i < this->rows; ++i)
+        positions[i] = ((coordinate_t) innerProducts[i] + this->shifts[i]) / (coordinate_t) this->window;
+}
+
+unsigned int ProjectionMatrix::getRows() const {
+    return this->rows;
+}
+
+unsigned int ProjectionMatrix::getDimensions() const {
+    return this->dimensions;
+}
+
+unsigned int ProjectionMatrix::getWindow() const {
+    return this->window;
+}
@@ -0,0 +1,39 @@
+#ifndef PROJECTIONMATRIX_H
+#define PROJECTIONMATRIX_H
+
+#include <vector>
+#include "../LSH-Function/LSHFunction.h"
+#include "../../Utilities/Index-Writer/IndexWriter.h"
+#include "../../Utilities/Index-Reader/IndexReader.h"
+
+/* Class that packs the unit vectors of a number of h_i() functions - which share the same window - into the rows of a dense row-major matrix
+ * Thus the positions of a Point on the lines of all the h_i() functions are calculated with a single matrix-vector product */
+
+class ProjectionMatrix {
+
+private:
+    unsigned int rows;
+    unsigned int dimensions;
+    unsigned int window;
+    coordinate_t *unitVectors;
+    coordinate_t *shifts;
+    /* Whether the rows are owned or belong to another ProjectionMatrix, see the view constructor */
+    bool ownsRows;
+    explicit ProjectionMatrix(const std::vector<const ProjectionMatrix *> &);
+
+public:
+    static ProjectionMatrix *createProjectionMatrix(const std::vector<const ProjectionMatrix *> &);
+    ProjectionMatrix(unsigned int, unsigned int, unsigned int);
+    ProjectionMatrix(ProjectionMatrix &, unsigned int, unsigned int);
+    explicit ProjectionMatrix(IndexReader &);
+    ~ProjectionMatrix();
+    void save(IndexWriter &) const;
+    void setRow(unsigned int, const LSHFunction &);
+    void project(const Point &, coordinate_t *) const;
+    unsigned int getRows() const;
+    unsigned int getDimensions() const;
+    unsigned int getWindow() const;
+};
+
+
+#endif
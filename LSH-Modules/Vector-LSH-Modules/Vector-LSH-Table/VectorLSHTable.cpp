@@ -1,75 +1,269 @@
+#include <queue>
+#include <tuple>
+#include <algorithm>
 #include "VectorLSHTable.h"
 #include "../../../Utilities/Arithmetic/Arithmetic.h"
+#include "../../../Utilities/Parallel/Parallel.h"
 
-VectorLSHTable::VectorLSHTable(unsigned int id, unsigned int dimensions, double norm, unsigned int window, unsigned int k, unsigned int size) {
+const unsigned int VectorLSHTable::BLOCK_SIZE = 4096;
+
+/* Constructor whose amplified hash function uses the rows [firstRow, firstRow + k) of the given ProjectionMatrix, which is shared by the hash tables of a VectorLSH */
+VectorLSHTable::VectorLSHTable(unsigned int id, ProjectionMatrix &projectionMatrix, unsigned int firstRow, double norm, unsigned int k, unsigned int size) {
 
     this->id = id;
     this->size = size;
 
     /* Create an amplified hash function */
-    this->lshHashFunction = new LSHHashFunction(dimensions, norm, window, k);
+    this->lshHashFunction = new LSHHashFunction(projectionMatrix, firstRow, norm, k);
 
-    /* Create |size| std::vector<std::pair<unsigned int,Point*>> which act as the buckets of the hash table
-     * Each bucket stores the Points assigned to it and their corresponding amplified hash values */
-    this->buckets = new std::vector<std::pair<unsigned int, Point *>>[size];
+    /* The hash table is stored in CSR form : the entries of all |size| buckets are stored contiguously, grouped by bucket and in insertion order within each bucket
+     * The entries of bucket Y are [bucketOffsets[Y], bucketOffsets[Y + 1]) and each entry is the id of a Point - assigned by VectorLSH - and its corresponding amplified hash value */
+    this->bucketOffsets.assign(size + 1, 0);
 }
 
-VectorLSHTable::~VectorLSHTable() {
+/* Constructor that reads the hash table written by VectorLSHTable::save, whose entries should be ids less than the given number of Points */
+VectorLSHTable::VectorLSHTable(IndexReader &indexReader, unsigned int totalPoints) {
+
+    this->id = indexReader.readValue<uint32_t>();
+    this->size = indexReader.readValue<uint32_t>();
+    this->lshHashFunction = new LSHHashFunction(indexReader);
+    indexReader.readArray(this->bucketOffsets);
+    indexReader.readArray(this->entryHashValues);
+    indexReader.readArray(this->entryIds);
+
+    /* The CSR arrays should be consistent with each other, otherwise a lookup could read past their ends */
+    bool consistent = this->size > 0 && this->bucketOffsets.size() == this->size + 1 && this->bucketOffsets[0] == 0 && this->bucketOffsets[this->size] == this->entryIds.size() && this->entryHashValues.size() == this->entryIds.size();
+
+    for (unsigned int i = 0; consistent && i < this->size; ++i)
+        if (this->bucketOffsets[i] > this->bucketOffsets[i + 1])
+            consistent = false;
+
+    for (unsigned int i = 0; consistent && i < this->entryIds.size(); ++i)
+        if (this->entryIds[i] >= totalPoints)
+            consistent = false;
+
+    if (!consistent) {
+        indexReader.invalidate();
+        this->size = 1;
+        this->bucketOffsets.assign(2, 0);
+        this->entryHashValues.clear();
+        this->entryIds.clear();
+    }
+}
 
+VectorLSHTable::~VectorLSHTable() {
     delete this->lshHashFunction;
-    delete[] this->buckets;
 }
 
-unsigned int VectorLSHTable::hashPoint(const Point &point) {
-    return this->lshHashFunction->hash(point);
+void VectorLSHTable::save(IndexWriter &indexWriter) const {
+
+    indexWriter.writeValue<uint32_t>(this->id);
+    indexWriter.writeValue<uint32_t>(this->size);
+    this->lshHashFunction->save(indexWriter);
+    indexWriter.writeArray(this->bucketOffsets);
+    indexWriter.writeArray(this->entryHashValues);
+    indexWriter.writeArray(this->entryIds);
+}
+
+/* Function to share the rows [firstRow, firstRow + k) of the given ProjectionMatrix, which should be identical to the ones of the hash table's own */
+void VectorLSHTable::shareProjectionMatrix(ProjectionMatrix &projectionMatrix, unsigned int firstRow) {
+    this->lshHashFunction->shareProjectionMatrix(projectionMatrix, firstRow);
+}
+
+/* The following functions take a Point by its positions on the lines of the table's k h_i() functions, as calculated by the rows of VectorLSHTable::getProjectionMatrix
+ * Thus VectorLSH projects each Point once for all of its hash tables */
+
+unsigned int VectorLSHTable::hash(const coordinate_t *positions) const {
+    return this->lshHashFunction->hash(positions);
 }
 
-void VectorLSHTable::insert(Point *const point) {
+/* Function to insert a single Point with the given id. Every following entry is shifted by one position, thus the given Points should be inserted in bulk whenever possible */
+void VectorLSHTable::insert(const coordinate_t *positions, unsigned int id) {
 
     /* Calculate the amplified hash value X of the given Point */
-    unsigned int amplifiedHashValue = this->hashPoint(*point);
+    unsigned int amplifiedHashValue = this->lshHashFunction->hash(positions);
 
     /* Calculate the bucket Y (X mod table-size) that the given Point should be assigned to */
     unsigned int position = Arithmetic::mod(amplifiedHashValue, this->size);
 
-    /* Assign the pair (X, Point*) to the corresponding bucket Y */
-    this->buckets[position].push_back(std::make_pair(amplifiedHashValue, point));
+    /* Append the pair (X, id) to the entries of bucket Y */
+    unsigned int entry = this->bucketOffsets[position + 1];
+    this->entryHashValues.insert(this->entryHashValues.begin() + entry, amplifiedHashValue);
+    this->entryIds.insert(this->entryIds.begin() + entry, id);
+
+    for (unsigned int i = position + 1; i <= this->size; ++i)
+        this->bucketOffsets[i]++;
 }
 
-std::vector<Point *> *VectorLSHTable::getSimilarPoints(Point *const point, int threshold) {
+/* Function to insert Points in bulk with the consecutive ids firstId, firstId + 1, ... given their amplified hash values - see VectorLSHTable::hash
+ * The hash table is rebuilt once, using a parallel counting sort of the new Points by bucket and at most the given number of threads */
+void VectorLSHTable::insert(const std::vector<unsigned int> &amplifiedHashValues, unsigned int firstId, unsigned int threads) {
 
+    /* Calculate the buckets of the given Points */
+    std::vector<unsigned int> buckets(amplifiedHashValues.size());
+    Parallel::parallelForBlocks(amplifiedHashValues.size(), VectorLSHTable::BLOCK_SIZE, threads, [&](unsigned int first, unsigned int last) {
+        for (unsigned int i = first; i < last; ++i)
+            buckets[i] = Arithmetic::mod(amplifiedHashValues[i], this->size);
+    });
 
-    std::vector<Point *> *similarPoints = new std::vector<Point *>;
+    /* Sort the new Points by bucket. The ones of bucket Y are order[newOffsets[Y]], ... , order[newOffsets[Y + 1] - 1] in insertion order */
+    std::vector<unsigned int> newOffsets;
+    std::vector<unsigned int> order;
+    Parallel::countingSort(buckets, this->size, threads, newOffsets, order);
 
-    /* Calculate the amplified hash value X of the given Point */
-    unsigned int amplifiedHashValue = this->hashPoint(*point);
+    /* Each bucket's new offset is the sum of the already stored and the new entries of the preceding buckets */
+    std::vector<unsigned int> offsets(this->size + 1);
+    for (unsigned int i = 0; i <= this->size; ++i)
+        offsets[i] = this->bucketOffsets[i] + newOffsets[i];
+
+    std::vector<unsigned int> hashValues(offsets[this->size]);
+    std::vector<unsigned int> entries(offsets[this->size]);
+
+    /* The already stored entries of each bucket precede the new ones, so that the insertion order is preserved. Each bucket is filled independently */
+    Parallel::parallelForBlocks(this->size, VectorLSHTable::BLOCK_SIZE, threads, [&](unsigned int first, unsigned int last) {
+
+        for (unsigned int i = first; i < last; ++i) {
+
+            unsigned int cursor = offsets[i];
+
+            for (unsigned int j = this->bucketOffsets[i]; j < this->bucketOffsets[i + 1]; ++j, ++cursor) {
+                hashValues[cursor] = this->entryHashValues[j];
+                entries[cursor] = this->entryIds[j];
+            }
+
+            for (unsigned int j = newOffsets[i]; j < newOffsets[i + 1]; ++j, ++cursor) {
+                hashValues[cursor] = amplifiedHashValues[order[j]];
+                entries[cursor] = firstId + order[j];
+            }
+        }
+    });
+
+    this->bucketOffsets.swap(offsets);
+    this->entryHashValues.swap(hashValues);
+    this->entryIds.swap(entries);
+}
+
+/* Utility function to calculate the amplified hash values of the buckets that should be probed for the given Point (multi-probe LSH)
+ * The first one is the Point's own amplified hash value and the rest result from perturbing the h_i() values of the Point by -1 or +1
+ * A perturbation set is scored by the sum of the squared distances of the Point from the boundaries that it crosses,
+ * thus the buckets that are the most likely to contain the Point's neighbors are probed first
+ * The perturbation sets are generated in ascending order of their scores using a min-heap and the shift/expand operations of Lv et al. */
+void VectorLSHTable::getProbedHashValues(const coordinate_t *positions, unsigned int probes, std::vector<unsigned int> &hashValues) const {
+
+    hashValues.clear();
+
+    /* Only the Point's own bucket is probed */
+    if (probes == 0) {
+        hashValues.push_back(this->lshHashFunction->hash(positions));
+        return;
+    }
+
+    unsigned int k = this->lshHashFunction->getK();
+    std::vector<long long int> slots(k);
+    std::vector<coordinate_t> offsets(k);
+
+    unsigned int amplifiedHashValue = this->lshHashFunction->hash(positions, slots.data(), offsets.data());
+    hashValues.push_back(amplifiedHashValue);
+
+    /* The 2k single perturbations (h_i(), delta) sorted by their squared distance from the corresponding boundary */
+    std::vector<std::tuple<coordinate_t, unsigned int, int>> perturbations;
+    for (unsigned int i = 0; i < k; ++i) {
+        perturbations.push_back(std::make_tuple(offsets[i] * offsets[i], i, -1));
+        perturbations.push_back(std::make_tuple((1 - offsets[i]) * (1 - offsets[i]), i, 1));
+    }
+    std::sort(perturbations.begin(), perturbations.end());
+
+    /* A perturbation set is stored as the ascending indices of its perturbations in the sorted array alongside its score */
+    typedef std::pair<coordinate_t, std::vector<unsigned int>> PerturbationSet;
+    std::priority_queue<PerturbationSet, std::vector<PerturbationSet>, std::greater<PerturbationSet>> heap;
+    heap.push(PerturbationSet(std::get<0>(perturbations[0]), {0}));
+
+    while (!heap.empty() && hashValues.size() <= probes) {
+
+        PerturbationSet perturbationSet = heap.top();
+        heap.pop();
+
+        unsigned int last = perturbationSet.second.back();
+
+        if (last + 1 < perturbations.size()) {
+
+            /* Shift : replace the last perturbation with the next one */
+            PerturbationSet shifted = perturbationSet;
+            shifted.first += std::get<0>(perturbations[last + 1]) - std::get<0>(perturbations[last]);
+            shifted.second.back() = last + 1;
+            heap.push(shifted);
+
+            /* Expand : add the next perturbation */
+            PerturbationSet expanded = perturbationSet;
+            expanded.first += std::get<0>(perturbations[last + 1]);
+            expanded.second.push_back(last + 1);
+            heap.push(expanded);
+        }
+
+        /* A set that perturbs the same h_i() value both by -1 and +1 is invalid */
+        bool valid = true;
+        for (unsigned int i = 0; i < perturbationSet.second.size() && valid; ++i)
+            for (unsigned int j = i + 1; j < perturbationSet.second.size() && valid; ++j)
+                if (std::get<1>(perturbations[perturbationSet.second[i]]) == std::get<1>(perturbations[perturbationSet.second[j]]))
+                    valid = false;
+
+        if (valid) {
+
+            unsigned int perturbedHashValue = amplifiedHashValue;
+            for (unsigned int index: perturbationSet.second) {
+                unsigned int i = std::get<1>(perturbations[index]);
+                perturbedHashValue = this->lshHashFunction->perturb(perturbedHashValue, i, slots[i], std::get<2>(perturbations[index]));
+            }
+
+            hashValues.push_back(perturbedHashValue);
+        }
+    }
+}
+
+/* Function to store the ids of the Points that are similar to the given Point in similarPoints, which is cleared first
+ * The caller provides the array so that it can be reused across hash tables and queries */
+void VectorLSHTable::getSimilarPoints(const coordinate_t *positions, int threshold, unsigned int probes, std::vector<unsigned int> &similarPoints) const {
+
+    similarPoints.clear();
+
+    /* Calculate the amplified hash value X of the given Point alongside the ones of the '-probes' buckets that should also be probed
+     * The array is kept per thread, so that it is only allocated once */
+    thread_local std::vector<unsigned int> hashValues;
+    this->getProbedHashValues(positions, probes, hashValues);
 
     /* Calculate the bucket Y (X mod table-size) of the given Point */
-    unsigned int position = Arithmetic::mod(amplifiedHashValue, this->size);
+    unsigned int position = Arithmetic::mod(hashValues[0], this->size);
 
-    /* For each pair (Xi,Point*i) in Y get the ones (Point*i) that Xi = X */
-    for (std::pair<unsigned int, Point *> pair: this->buckets[position])
-        if (pair.first == amplifiedHashValue)
-            similarPoints->push_back(pair.second);
+    /* For each probed value Z and each entry (Xi,idi) in the bucket Z mod table-size get the ones (idi) that Xi = Z */
+    for (unsigned int hashValue: hashValues) {
+
+        unsigned int bucket = Arithmetic::mod(hashValue, this->size);
+
+        for (unsigned int i = this->bucketOffsets[bucket]; i < this->bucketOffsets[bucket + 1]; ++i)
+            if (this->entryHashValues[i] == hashValue)
+                similarPoints.push_back(this->entryIds[i]);
+    }
+
+    unsigned int bucketStart = this->bucketOffsets[position];
+    unsigned int bucketEnd = this->bucketOffsets[position + 1];
 
     /* If no Points were found due to the fact that Y was not empty and no Xi was equal to X */
-    if (similarPoints->empty() && !this->buckets[position].empty()) {
+    if (similarPoints.empty() && bucketStart != bucketEnd) {
 
         /* If the threshold defined in VectorLSH is equal to 0 get each available Point */
         if (threshold == 0)
-            for (std::pair<unsigned int, Point *> pair: this->buckets[position])
-                similarPoints->push_back(pair.second);
+            similarPoints.insert(similarPoints.end(), this->entryIds.begin() + bucketStart, this->entryIds.begin() + bucketEnd);
 
             /* Otherwise, get as many Points as possible */
         else
-            for (unsigned int i = 0; i < this->buckets[position].size() && threshold > 0; ++i) {
-                similarPoints->push_back(this->buckets[position].at(i).second);
+            for (unsigned int i = bucketStart; i < bucketEnd && threshold > 0; ++i) {
+                similarPoints.push_back(this->entryIds[i]);
                 threshold--;
             }
 
     }
-
-    return similarPoints;
 }
 
-
+const ProjectionMatrix &VectorLSHTable::getProjectionMatrix() const {
+    return this->lshHashFunction->getProjectionMatrix();
+}
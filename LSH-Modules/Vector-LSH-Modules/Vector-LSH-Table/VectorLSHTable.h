@@ -10,17 +10,27 @@
 class VectorLSHTable {
 
 private:
+    static const unsigned int BLOCK_SIZE;
+
     unsigned int id;
     unsigned int size;
     LSHHashFunction *lshHashFunction;
-    std::vector<std::pair<unsigned int, Point *>> *buckets;
-    unsigned int hashPoint(const Point &);
+    std::vector<unsigned int> bucketOffsets;
+    std::vector<unsigned int> entryHashValues;
+    std::vector<unsigned int> entryIds;
+    void getProbedHashValues(const coordinate_t *, unsigned int, std::vector<unsigned int> &) const;
 
 public:
-    VectorLSHTable(unsigned int, unsigned int, double, unsigned int, unsigned int, unsigned int);
+    VectorLSHTable(unsigned int, ProjectionMatrix &, unsigned int, double, unsigned int, unsigned int);
+    VectorLSHTable(IndexReader &, unsigned int);
     ~VectorLSHTable();
-    void insert(Point *const);
-    std::vector<Point *> *getSimilarPoints(Point *const, int);
+    void save(IndexWriter &) const;
+    void shareProjectionMatrix(ProjectionMatrix &, unsigned int);
+    void insert(const coordinate_t *, unsigned int);
+    void insert(const std::vector<unsigned int> &, unsigned int, unsigned int);
+    unsigned int hash(const coordinate_t *) const;
+    void getSimilarPoints(const coordinate_t *, int, unsigned int, std::vector<unsigned int> &) const;
+    const ProjectionMatrix &getProjectionMatrix() const;
 };
 
 
@@ -1,46 +1,157 @@
 #include <chrono>
-#include <unordered_map>
 #include "VectorLSH.h"
+#include "../../../Utilities/Bounded-Heap/BoundedHeap.h"
+#include "../../../Utilities/Visited-Set/VisitedSet.h"
+#include "../../../Utilities/Parallel/Parallel.h"
 
-VectorLSH::VectorLSH(unsigned int dimensions, long double norm, unsigned int k, unsigned int w, unsigned int L, unsigned int hashTableSize, int threshold) : VectorMethod(dimensions, norm, k, w) {
+const unsigned int VectorLSH::BLOCK_SIZE = 1024;
 
-    /* Create L hash tables */
+VectorLSH::VectorLSH(unsigned int dimensions, double norm, unsigned int k, unsigned int w, unsigned int L, unsigned int hashTableSize, int threshold, unsigned int probes) : VectorMethod(dimensions, norm, k, w) {
+
+    /* Create L hash tables, whose projection matrices are the consecutive row ranges of a single one, so that a Point is projected once for all of them */
+    this->projectionMatrix = new ProjectionMatrix(L * k, this->dimensions, this->w);
     for (unsigned int i = 0; i < L; ++i)
-        this->vectorLSHTables.push_back(new VectorLSHTable(i, this->dimensions, this->norm, this->w, this->k, hashTableSize));
+        this->vectorLSHTables.push_back(new VectorLSHTable(i, *this->projectionMatrix, i * this->k, this->norm, this->k, hashTableSize));
 
     /* VectorLSH::threshold defines the maximum number of Points that will be examined when using VectorLSH::getApproximateNearestNeighbor/VectorLSH::rangeSearch
      * In case VectorLSH::threshold = 0 then ALL eligible Points will be examined  */
     this->threshold = threshold;
     if (this->threshold < 0)
         this->threshold = 0;
+
+    /* VectorLSH::probes defines the number of additional buckets that will be probed in each hash table (multi-probe LSH)
+     * In case VectorLSH::probes = 0 then only the bucket of the query Point will be probed */
+    this->probes = probes;
+}
+
+/* Constructor that reads the VectorLSH written by VectorLSH::save, given the dataset that its Points were inserted from */
+VectorLSH::VectorLSH(IndexReader &indexReader, const std::vector<Point *> &dataset) : VectorMethod(indexReader) {
+
+    this->threshold = indexReader.readValue<int32_t>();
+    this->probes = indexReader.readValue<uint32_t>();
+    VectorMethod::loadPoints(indexReader, dataset, this->points);
+
+    uint32_t L = indexReader.readValue<uint32_t>();
+    for (unsigned int i = 0; i < L && indexReader.isValid(); ++i)
+        this->vectorLSHTables.push_back(new VectorLSHTable(indexReader, this->points.size()));
+
+    /* Each hash table should project a Point on exactly k lines, as its positions are [i * k, (i + 1) * k) of the stacked projection matrix */
+    std::vector<const ProjectionMatrix *> projectionMatrices;
+    for (VectorLSHTable *vectorLSHTable: this->vectorLSHTables) {
+
+        if (vectorLSHTable->getProjectionMatrix().getRows() != this->k || vectorLSHTable->getProjectionMatrix().getDimensions() != this->dimensions)
+            indexReader.invalidate();
+
+        projectionMatrices.push_back(&vectorLSHTable->getProjectionMatrix());
+    }
+
+    /* The stacked projection matrix is only built out of valid hash tables, in which case the caller discards the VectorLSH */
+    this->projectionMatrix = nullptr;
+    if (indexReader.isValid())
+        this->projectionMatrix = ProjectionMatrix::createProjectionMatrix(projectionMatrices);
+
+    if (this->projectionMatrix == nullptr) {
+        indexReader.invalidate();
+        return;
+    }
+
+    /* The hash tables' own projection matrices are replaced by views of the stacked one, so that the rows are only stored once */
+    for (unsigned int i = 0; i < this->vectorLSHTables.size(); ++i)
+        this->vectorLSHTables[i]->shareProjectionMatrix(*this->projectionMatrix, i * this->k);
 }
 
 VectorLSH::~VectorLSH() {
 
     for (VectorLSHTable *vectorLSHTable: this->vectorLSHTables)
         delete vectorLSHTable;
+
+    delete this->projectionMatrix;
+}
+
+/* Function to write the VectorLSH, given the dataset that its Points were inserted from
+ * The stacked projection matrix is not written, as it is rebuilt from the hash tables' ones */
+void VectorLSH::save(IndexWriter &indexWriter, const std::vector<Point *> &dataset) const {
+
+    Method::save(indexWriter);
+    indexWriter.writeValue<int32_t>(this->threshold);
+    indexWriter.writeValue<uint32_t>(this->probes);
+    VectorMethod::savePoints(indexWriter, this->points, dataset);
+
+    indexWriter.writeValue<uint32_t>(this->vectorLSHTables.size());
+    for (VectorLSHTable *vectorLSHTable: this->vectorLSHTables)
+        vectorLSHTable->save(indexWriter);
 }
 
 void VectorLSH::insertPoint(Point *const point) {
 
     /* Insert the given Point to the VectorLSH's |L| hash tables */
-    if (point->getDimensions() == this->dimensions)
+    if (point->getDimensions() == this->dimensions) {
+
+        unsigned int id = this->points.size();
+        this->points.push_back(point);
+
+        std::vector<coordinate_t> positions(this->projectionMatrix->getRows());
+        this->projectionMatrix->project(*point, positions.data());
+
         for (unsigned int i = 0; i < this->vectorLSHTables.size(); ++i)
-            this->vectorLSHTables[i]->insert(point);
+            this->vectorLSHTables[i]->insert(positions.data() + i * this->k, id);
+    }
+}
+
+/* Function to insert the given Points in bulk using at most the given number of threads
+ * The Points are projected and hashed in parallel - each one once for all of the hash tables - and then each hash table is rebuilt once */
+void VectorLSH::build(const std::vector<Point *> &points, unsigned int threads) {
+
+    std::vector<Point *> validPoints;
+    for (Point *point: points)
+        if (point->getDimensions() == this->dimensions)
+            validPoints.push_back(point);
+
+    unsigned int firstId = this->points.size();
+    this->points.insert(this->points.end(), validPoints.begin(), validPoints.end());
+
+    /* The amplified hash values of the given Points in each hash table */
+    std::vector<std::vector<unsigned int>> amplifiedHashValues(this->vectorLSHTables.size(), std::vector<unsigned int>(validPoints.size()));
+
+    Parallel::parallelForBlocks(validPoints.size(), VectorLSH::BLOCK_SIZE, threads, [&](unsigned int first, unsigned int last) {
+
+        std::vector<coordinate_t> positions(this->projectionMatrix->getRows());
+
+        for (unsigned int i = first; i < last; ++i) {
+
+            this->projectionMatrix->project(*validPoints[i], positions.data());
+
+            for (unsigned int j = 0; j < this->vectorLSHTables.size(); ++j)
+                amplifiedHashValues[j][i] = this->vectorLSHTables[j]->hash(positions.data() + j * this->k);
+        }
+    });
+
+    /* Insert the given Points to the VectorLSH's |L| hash tables in bulk */
+    for (unsigned int i = 0; i < this->vectorLSHTables.size(); ++i)
+        this->vectorLSHTables[i]->insert(amplifiedHashValues[i], firstId, threads);
 }
 
-std::vector<Point *> *VectorLSH::rangeSearch(Point *const queryPoint, long double R, VectorMetric *vectorMetric) {
+std::vector<Point *> *VectorLSH::rangeSearch(Point *const queryPoint, distance_t R, VectorMetric *vectorMetric) const {
 
     std::vector<Point *> *rangeSearchNeighbors = new std::vector<Point *>;
 
     if (queryPoint->getDimensions() == this->dimensions) {
 
-        /* Data structure to check if a Point has already been examined */
-        std::unordered_map<Point *, bool> pointsConsidered;
+        /* Data structure to check if a Point has already been examined, which is kept per thread and indexed by the Points' ids */
+        thread_local VisitedSet pointsConsidered;
+        pointsConsidered.clear(this->points.size());
 
         int totalPointsConsidered = 0;
 
-        for (VectorLSHTable *vectorLSHTable: this->vectorLSHTables) {
+        /* Project the query Point once for all of the hash tables */
+        thread_local std::vector<coordinate_t> positions;
+        positions.resize(this->projectionMatrix->getRows());
+        this->projectionMatrix->project(*queryPoint, positions.data());
+
+        /* Array that is reused by every hash table to store the ids of its similar Points */
+        std::vector<unsigned int> similarPoints;
+
+        for (unsigned int i = 0; i < this->vectorLSHTables.size(); ++i) {
 
             if (this->threshold > 0 && totalPointsConsidered >= this->threshold)
                 break;
@@ -55,19 +166,20 @@ std::vector<Point *> *VectorLSH::rangeSearch(Point *const queryPoint, long doubl
                 pointsToGet = 1;
 
 
-            std::vector<Point *> *similarPoints = vectorLSHTable->getSimilarPoints(queryPoint, pointsToGet);
+            this->vectorLSHTables[i]->getSimilarPoints(positions.data() + i * this->k, pointsToGet, this->probes, similarPoints);
 
-            for (Point *similarPoint: *similarPoints) {
+            for (unsigned int similarPointId: similarPoints) {
 
                 /* Check if the similar Point has already been considered */
-                if (pointsConsidered.find(similarPoint) == pointsConsidered.end()) {
+                if (pointsConsidered.visit(similarPointId)) {
 
-                    long double distance = vectorMetric->distance(*queryPoint, *similarPoint);
+                    Point *similarPoint = this->points[similarPointId];
+
+                    distance_t distance = vectorMetric->distance(*queryPoint, *similarPoint);
 
                     if (distance <= R)
                         rangeSearchNeighbors->push_back(similarPoint);
 
-                    pointsConsidered[similarPoint] = true;
                     totalPointsConsidered++;
 
 
@@ -77,28 +189,36 @@ std::vector<Point *> *VectorLSH::rangeSearch(Point *const queryPoint, long doubl
                 }
             }
 
-            delete similarPoints;
         }
     }
 
     return rangeSearchNeighbors;
 }
 
-std::tuple<Point *, long double, double> VectorLSH::getApproximateNearestNeighbor(Point *const queryPoint, VectorMetric *vectorMetric) {
+std::tuple<Point *, distance_t, double> VectorLSH::getApproximateNearestNeighbor(Point *const queryPoint, VectorMetric *vectorMetric) const {
 
     if (queryPoint->getDimensions() == this->dimensions) {
 
-        /* Data structure to check if a Point has already been examined */
-        std::unordered_map<Point *, bool> pointsConsidered;
+        /* Data structure to check if a Point has already been examined, which is kept per thread and indexed by the Points' ids */
+        thread_local VisitedSet pointsConsidered;
+        pointsConsidered.clear(this->points.size());
 
         int totalPointsConsidered = 0;
-        long double minDistance = std::numeric_limits<long double>::max();
+        distance_t minDistance = std::numeric_limits<distance_t>::max();
         Point *nearestNeighbor = nullptr;
 
         /* Start the clock */
         std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
 
-        for (VectorLSHTable *vectorLSHTable: this->vectorLSHTables) {
+        /* Project the query Point once for all of the hash tables */
+        thread_local std::vector<coordinate_t> positions;
+        positions.resize(this->projectionMatrix->getRows());
+        this->projectionMatrix->project(*queryPoint, positions.data());
+
+        /* Array that is reused by every hash table to store the ids of its similar Points */
+        std::vector<unsigned int> similarPoints;
+
+        for (unsigned int i = 0; i < this->vectorLSHTables.size(); ++i) {
 
 
             if ((this->threshold > 0 && totalPointsConsidered >= this->threshold) || minDistance == 0.0)
@@ -115,20 +235,21 @@ std::tuple<Point *, long double, double> VectorLSH::getApproximateNearestNeighbo
                 pointsToGet = 1;
 
 
-            std::vector<Point *> *similarPoints = vectorLSHTable->getSimilarPoints(queryPoint, pointsToGet);
+            this->vectorLSHTables[i]->getSimilarPoints(positions.data() + i * this->k, pointsToGet, this->probes, similarPoints);
 
-            for (Point *similarPoint: *similarPoints) {
+            for (unsigned int similarPointId: similarPoints) {
 
                 /* Check if the similar Point has already been examined  */
-                if (pointsConsidered.find(similarPoint) == pointsConsidered.end()) {
+                if (pointsConsidered.visit(similarPointId)) {
+
+                    Point *similarPoint = this->points[similarPointId];
 
-                    long double distanceToQueryPoint = vectorMetric->distance(*queryPoint, *similarPoint, this->norm);
+                    distance_t distanceToQueryPoint = vectorMetric->distance(*queryPoint, *similarPoint, this->norm);
                     if (distanceToQueryPoint < minDistance) {
                         minDistance = distanceToQueryPoint;
                         nearestNeighbor = similarPoint;
                     }
 
-                    pointsConsidered[similarPoint] = true;
                     totalPointsConsidered++;
 
 
@@ -138,7 +259,6 @@ std::tuple<Point *, long double, double> VectorLSH::getApproximateNearestNeighbo
 
             }
 
-            delete similarPoints;
         }
 
         /* Stop the clock */
@@ -153,4 +273,61 @@ std::tuple<Point *, long double, double> VectorLSH::getApproximateNearestNeighbo
         return std::make_tuple(nullptr, -1.0, -1.0);
 }
 
+/* Function to get the (at most) k approximate nearest neighbors given a Vector metric, sorted in ascending order of their distances */
+std::vector<std::pair<Point *, distance_t>> *VectorLSH::getKNearestNeighbors(Point *const queryPoint, unsigned int k, VectorMetric *vectorMetric) const {
+
+    BoundedHeap<Point *> nearestNeighbors(k);
+
+    if (queryPoint->getDimensions() == this->dimensions) {
+
+        /* Data structure to check if a Point has already been examined, which is kept per thread and indexed by the Points' ids */
+        thread_local VisitedSet pointsConsidered;
+        pointsConsidered.clear(this->points.size());
+
+        int totalPointsConsidered = 0;
+
+        /* Project the query Point once for all of the hash tables */
+        thread_local std::vector<coordinate_t> positions;
+        positions.resize(this->projectionMatrix->getRows());
+        this->projectionMatrix->project(*queryPoint, positions.data());
+
+        /* Array that is reused by every hash table to store the ids of its similar Points */
+        std::vector<unsigned int> similarPoints;
+
+        for (unsigned int i = 0; i < this->vectorLSHTables.size(); ++i) {
+
+            if (this->threshold > 0 && totalPointsConsidered >= this->threshold)
+                break;
+
+            /* See VectorLSHTable::getSimilarPoints for more */
+            int pointsToGet;
+            if (this->threshold == 0)
+                pointsToGet = 0;
+            else if ((this->threshold / this->vectorLSHTables.size()) > 0)
+                pointsToGet = this->threshold / this->vectorLSHTables.size();
+            else
+                pointsToGet = 1;
+
+            this->vectorLSHTables[i]->getSimilarPoints(positions.data() + i * this->k, pointsToGet, this->probes, similarPoints);
+
+            for (unsigned int similarPointId: similarPoints) {
+
+                /* Check if the similar Point has already been examined  */
+                if (pointsConsidered.visit(similarPointId)) {
+
+                    Point *similarPoint = this->points[similarPointId];
+
+                    nearestNeighbors.push(similarPoint, vectorMetric->distance(*queryPoint, *similarPoint, this->norm));
+
+                    totalPointsConsidered++;
+
+                    if (this->threshold > 0 && totalPointsConsidered >= this->threshold)
+                        break;
+                }
+            }
 
+        }
+    }
+
+    return nearestNeighbors.toSortedVector();
+}
@@ -8,17 +8,28 @@
 class VectorLSH : public VectorMethod {
 
 private:
+    static const unsigned int BLOCK_SIZE;
+
     std::vector<VectorLSHTable *> vectorLSHTables;
+    /* The rows of the |L| hash tables' projection matrices stacked, thus the ith hash table's projection matrix is a view of the rows [i * k, (i + 1) * k) */
+    ProjectionMatrix *projectionMatrix;
+    /* The inserted Points in insertion order, thus a Point's id is its position */
+    std::vector<Point *> points;
     int threshold;
+    unsigned int probes;
 
 
 public:
-    VectorLSH(unsigned int, long double, unsigned int, unsigned int, unsigned int, unsigned int, int);
+    VectorLSH(unsigned int, double, unsigned int, unsigned int, unsigned int, unsigned int, int, unsigned int);
+    VectorLSH(IndexReader &, const std::vector<Point *> &);
     virtual ~VectorLSH();
 
+    void save(IndexWriter &, const std::vector<Point *> &) const;
     void insertPoint(Point *const);
-    std::tuple<Point *, long double, double> getApproximateNearestNeighbor(Point *const, VectorMetric *);
-    std::vector<Point *> *rangeSearch(Point *const, long double, VectorMetric *);
+    void build(const std::vector<Point *> &, unsigned int);
+    std::tuple<Point *, distance_t, double> getApproximateNearestNeighbor(Point *const, VectorMetric *) const;
+    std::vector<Point *> *rangeSearch(Point *const, distance_t, VectorMetric *) const;
+    std::vector<std::pair<Point *, distance_t>> *getKNearestNeighbors(Point *const, unsigned int, VectorMetric *) const;
 };
 
 
@@ -5,15 +5,17 @@
 #include "../../Cluster-Modules/Curve-Clustering/Curve-Clustering/CurveClustering.h"
 #include "../../Metric-Modules/Discrete-Frechet/DiscreteFrechet.h"
 #include "../../Utilities/Parser/Parser.h"
+#include "../../Vector-Modules/Dataset/Dataset.h"
 #include "../../LSH-Modules/Curve-LSH-Modules/Curve-LSH/CurveLSH.h"
 #include "../../Metric-Modules/LP-Norm/LPNorm.h"
 #include "../../Cluster-Modules/Vector-Clustering/Vector-Clustering/VectorClustering.h"
 #include "../../LSH-Modules/Vector-LSH-Modules/Vector-LSH/VectorLSH.h"
 #include "../../Hypercube-Modules/Hypercube/Hypercube.h"
+#include "../../Utilities/Parallel/Parallel.h"
 #include <iostream>
 #include <fstream>
 
-const long double AppliedClustering::norm = 2.0;
+const double AppliedClustering::norm = 2.0;
 
 void AppliedClustering::appliedClustering(int argc, char **argv) {
 
@@ -63,9 +65,9 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
         /* Parse Curves in Input File as 2 or 1 dimensional */
         std::vector<Curve *> *inputCurves;
         if (updateMethod == "Mean-Frechet")
-            inputCurves = Parser::parseCurvesFile(inputFilePath, 2, 1.0, 0);
+            inputCurves = Parser::parseCurvesFile(inputFilePath, 2, 1.0, 0, Parallel::getHardwareThreads());
         else
-            inputCurves = Parser::parseCurvesFile(inputFilePath, 1, 1.0, 0);
+            inputCurves = Parser::parseCurvesFile(inputFilePath, 1, 1.0, 0, Parallel::getHardwareThreads());
 
         /* See Parser::parseCurvesFile for more */
         if (inputCurves->empty()) {
@@ -76,9 +78,9 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
             return;
         }
 
-        /* Get the vectorial representations of the Curves */
-        std::vector<Point *> vectorialCurves;
-        AppliedClustering::getVectorialRepresentations(*inputCurves, vectorialCurves);
+        /* Store the vectorial representations of the Curves contiguously */
+        Dataset *dataset = Dataset::createDataset(*inputCurves, false);
+        std::vector<Point *> vectorialCurves = dataset->getPoints();
 
         /* Create a LP (L2) Vector metric */
         VectorMetric *vectorMetric = new LPNorm(AppliedClustering::norm);
@@ -97,7 +99,7 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
             if (assignmentMethod == "LSH_Frechet") {
 
                 /* CurveMethod's parameters initialization */
-                long double norm = AppliedClustering::norm;
+                double norm = AppliedClustering::norm;
 
                 unsigned int k = clusteringParameters->getLSHK();
 
@@ -116,14 +118,13 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
 
                 unsigned int exponent = 5;
 
-                long double delta = CurveMethod::calculateOptimalDelta(*inputCurves, gridDimensions, exponent);
+                coordinate_t delta = CurveMethod::calculateOptimalDelta(*inputCurves, gridDimensions, exponent);
 
                 bool continuous = false;
 
                 curveMethod = new CurveLSH(dimensions, norm, k, w, L, hashTableSize, threshold, gridDimensions, delta, continuous);
 
-                for (Curve *curve: *inputCurves)
-                    curveMethod->insertCurve(curve);
+                curveMethod->build(*inputCurves, Parallel::getHardwareThreads());
             }
 
             CurveClustering curveClustering;
@@ -144,7 +145,7 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
             /* VectorLSH-Hypercube shared variables */
             unsigned int dimensions = vectorialCurves[0]->getDimensions();
 
-            long double norm = AppliedClustering::norm;
+            double norm = AppliedClustering::norm;
 
             /* Optimal w calculation. Percentage argument is 0 here due to the fact the provided Input file is of a minimal size */
             unsigned int w = VectorMethod::calculateOptimalWindow(0.0, vectorialCurves, vectorMetric);
@@ -160,7 +161,7 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
                 /* (inputCurves->size() / x) + 1 in case (inputCurves->size() / x) == 0 */
                 unsigned int threshold = (inputCurves->size() / 3) + 1;
 
-                vectorMethod = new VectorLSH(dimensions, norm, k, w, L, hashTableSize, threshold);
+                vectorMethod = new VectorLSH(dimensions, norm, k, w, L, hashTableSize, threshold, 0);
 
             }
             else if (assignmentMethod == "Hypercube") {
@@ -171,8 +172,7 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
             }
 
             if (vectorMethod != nullptr)
-                for (Point *point: vectorialCurves)
-                    vectorMethod->insertPoint(point);
+                vectorMethod->build(vectorialCurves, Parallel::getHardwareThreads());
 
 
             VectorClustering vectorClustering;
@@ -188,6 +188,7 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
 
 
         delete vectorMetric;
+        delete dataset;
         for (Curve *curve: *inputCurves)
             delete curve;
         delete inputCurves;
@@ -196,13 +197,6 @@ void AppliedClustering::appliedClustering(int argc, char **argv) {
     }
 }
 
-/* Utility function to get the vectorial representations of the Curves in inputCurves and insert them in vectorialRepresentations */
-void AppliedClustering::getVectorialRepresentations(const std::vector<Curve *> &inputCurves, std::vector<Point *> &vectorialRepresentations) {
-
-    for (Curve *curve: inputCurves)
-        vectorialRepresentations.push_back(curve->getVectorialRepresentation());
-}
-
 
 /* Utility function to request the file path of an existing file */
 std::string AppliedClustering::requestOutputFilePath() {
@@ -10,9 +10,8 @@ class AppliedClustering{
 
     private:
 
-    static const long double norm;
+    static const double norm;
     static std::string requestOutputFilePath();
-    static void getVectorialRepresentations(const std::vector<Curve *>&, std::vector<Point *>&);
     static void printVectorClusteringResults(const std::string&, const std::string&, VectorClusteringResults*, bool, bool);
     static void printCurveClusteringResults(const std::string&, const std::string&, CurveClusteringResults*, bool, bool);
 
@@ -0,0 +1,87 @@
+#include <iostream>
+#include "AppliedConversion.h"
+#include "../../Utilities/File/File.h"
+#include "../../Utilities/Parser/Parser.h"
+#include "../../Utilities/Parallel/Parallel.h"
+
+/* Utility function to parse the arguments '-i', '-o' and the optional '-precision', which defaults to double */
+bool AppliedConversion::parseCMDArguments(int argc, char **argv, std::string &inputFilePath, std::string &outputFilePath, std::string &precision) {
+
+    if ((argc - 1) % 2 != 0 || argc < 5 || argc > 7) {
+        std::cout << "Error : Invalid number of arguments was provided" << std::endl;
+        return false;
+    }
+
+    precision = "double";
+
+    for (int i = 1; i < argc; i += 2) {
+
+        std::string parameter(argv[i]);
+        std::string value(argv[i + 1]);
+
+        if (parameter == "-i" && inputFilePath.empty())
+            inputFilePath = value;
+
+        else if (parameter == "-o" && outputFilePath.empty())
+            outputFilePath = value;
+
+        else if (parameter == "-precision" && (value == "float" || value == "double"))
+            precision = value;
+
+        else {
+            std::cout << "Error : Invalid or repeated parameter '" << parameter << "'" << std::endl;
+            return false;
+        }
+    }
+
+    if (inputFilePath.empty() || outputFilePath.empty()) {
+        std::cout << "Error : Both '-i' and '-o' should be provided" << std::endl;
+        return false;
+    }
+
+    if (!File::canOpenFile(inputFilePath) || File::isFileEmpty(inputFilePath)) {
+        std::cout << "Error : Could not open file " << inputFilePath << " or it is empty" << std::endl;
+        return false;
+    }
+
+    if (!Parser::isBinaryCurvesFile(inputFilePath) && File::isInWindowsFormat(inputFilePath)) {
+        std::cout << "Error : File " << inputFilePath << " is in Windows format meaning its new line character set is '\\r\\n' " << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void AppliedConversion::appliedConversion(int argc, char **argv) {
+
+    std::string inputFilePath;
+    std::string outputFilePath;
+    std::string precision;
+
+    if (!AppliedConversion::parseCMDArguments(argc, argv, inputFilePath, outputFilePath, precision))
+        return;
+
+    std::cout << "\nParsing Input file : '" << inputFilePath << "'..." << std::endl;
+
+    /* The Curves are stored as time-series, search and cluster add the x coordinates themselves when they need 2-dimensional Curves */
+    std::vector<Curve *> *inputCurves = Parser::parseCurvesFile(inputFilePath, 1, 1.0, 0, Parallel::getHardwareThreads());
+
+    /* See Parser::parseCurvesFile for more */
+    if (inputCurves->empty()) {
+        delete inputCurves;
+        std::cout << "Error : No valid Curves were found in '" << inputFilePath << "'" << std::endl;
+        return;
+    }
+
+    std::cout << "Writing " << inputCurves->size() << " Curves of complexity " << inputCurves->at(0)->getComplexity() << " to '" << outputFilePath << "'..." << std::endl;
+
+    uint32_t coordinateSize = (precision == "float") ? sizeof(float) : sizeof(double);
+
+    if (!Parser::writeBinaryCurvesFile(outputFilePath, *inputCurves, coordinateSize))
+        std::cout << "Error : Could not write '" << outputFilePath << "'" << std::endl;
+
+    for (Curve *curve: *inputCurves)
+        delete curve;
+
+    delete inputCurves;
+}
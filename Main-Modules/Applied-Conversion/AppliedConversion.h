@@ -0,0 +1,19 @@
+#ifndef APPLIEDCONVERSION_H
+#define APPLIEDCONVERSION_H
+
+#include <string>
+
+/* Static class that converts a Curves file to the binary Curves format, which search and cluster accept in place of the text format
+ * Usage : ./convert -i <input file> -o <output file> [-precision float|double] */
+class AppliedConversion {
+
+private:
+    static bool parseCMDArguments(int, char **, std::string &, std::string &, std::string &);
+
+public:
+    static void appliedConversion(int, char **);
+
+};
+
+
+#endif
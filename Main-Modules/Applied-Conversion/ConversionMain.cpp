@@ -0,0 +1,8 @@
+#include "AppliedConversion.h"
+
+int main(int argc, char **argv) {
+
+    AppliedConversion::appliedConversion(argc, argv);
+
+    return 0;
+}
@@ -1,9 +1,13 @@
 #include <iostream>
 #include <vector>
-#include <fstream>
 #include "AppliedSearch.h"
 #include "../../Utilities/File/File.h"
 #include "../../Utilities/Parser/Parser.h"
+#include "../../Utilities/Parallel/Parallel.h"
+#include "../../Utilities/Query-Stream/QueryStream.h"
+#include "../../Utilities/Ground-Truth-Cache/GroundTruthCache.h"
+#include "../../Utilities/Result-Writer/ResultWriter.h"
+#include "../../Vector-Modules/Dataset/Dataset.h"
 #include "../../Hypercube-Modules/Hypercube/Hypercube.h"
 #include "../../LSH-Modules/Vector-LSH-Modules/Vector-LSH/VectorLSH.h"
 #include "../../Method-Modules/Curve-Method/CurveMethod.h"
@@ -13,14 +17,11 @@
 #include "../../Metric-Modules/LP-Norm/LPNorm.h"
 
 
-const long double AppliedSearch::norm = 2.0;
-
-/* Utility function to get the vectorial representations of the Curves in inputCurves and insert them in vectorialRepresentations */
-void AppliedSearch::getVectorialRepresentations(const std::vector<Curve *> &inputCurves, std::vector<Point *> &vectorialRepresentations) {
-
-    for (Curve *curve: inputCurves)
-        vectorialRepresentations.push_back(curve->getVectorialRepresentation());
-}
+const double AppliedSearch::norm = 2.0;
+const uint32_t AppliedSearch::LSH_INDEX = 1;
+const uint32_t AppliedSearch::HYPERCUBE_INDEX = 2;
+const uint32_t AppliedSearch::FRECHET_INDEX = 3;
+const unsigned int AppliedSearch::STREAM_BATCH_SIZE_PER_THREAD = 16;
 
 void AppliedSearch::appliedSearch(int argc, char **argv) {
 
@@ -28,24 +29,53 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
 
     if (searchArguments != nullptr) {
 
+        std::string algorithm = searchArguments->getAlgorithm();
+        std::string metric = searchArguments->getMetric();
+        unsigned int w;
+        unsigned int threshold;
+        unsigned int initialCurveComplexity;
+        coordinate_t delta = searchArguments->getDelta();
+        coordinate_t epsilon = searchArguments->getEpsilon();
+
+        /* In case '-load-index' was provided the algorithm, its parameters, the Input Curves and the data structure are read from the index file */
+        std::string loadIndexPath = searchArguments->getLoadIndexPath();
+        IndexReader *indexReader = nullptr;
+
+        if (!loadIndexPath.empty()) {
+
+            std::cout << "\nLoading Index file : '" << loadIndexPath << "'..." << std::endl;
+
+            indexReader = IndexReader::createIndexReader(loadIndexPath);
+
+            if (indexReader != nullptr) {
+                algorithm = AppliedSearch::getIndexAlgorithm(indexReader->getKind());
+                AppliedSearch::loadParameters(*indexReader, searchArguments, metric, w, threshold, delta, epsilon, initialCurveComplexity);
+            }
+
+            if (indexReader == nullptr || algorithm.empty() || !indexReader->isValid() || (algorithm == "Frechet" && metric != "discrete" && metric != "continuous")) {
+                delete indexReader;
+                delete searchArguments;
+                std::cout << "Error : '" << loadIndexPath << "' is not a valid Index file" << std::endl;
+                return;
+            }
+        }
+
         /* Request the file path of an existing, not empty, and in Linux format file */
         std::string inputFilePath = searchArguments->getInputFilePath();
-        if (inputFilePath.empty())
+        if (inputFilePath.empty() && indexReader == nullptr)
             inputFilePath = AppliedSearch::requestInputFilePath();
 
         /* Request algorithm */
-        std::string algorithm = searchArguments->getAlgorithm();
         if (algorithm.empty())
             algorithm = AppliedSearch::requestAlgorithm(searchArguments);
 
         /* Request metric */
-        std::string metric = searchArguments->getMetric();
         if (algorithm == "Frechet" && metric.empty())
             metric = AppliedSearch::requestFrechetMetric(searchArguments);
 
         /* Request the file path of an existing, not empty, and in Linux format file */
         std::string queryFilePath = searchArguments->getQueryFilePath();
-        if (queryFilePath.empty())
+        if (queryFilePath.empty() && searchArguments->getStreamPath().empty())
             queryFilePath = AppliedSearch::requestQueryFilePath();
 
         /* Request the file path of an existing file */
@@ -54,9 +84,13 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
             outputFilePath = AppliedSearch::requestOutputFilePath();
 
         std::vector<Curve *> *inputCurves;
-        std::vector<Point *> vectorialInputCurves;
-        unsigned int w;
+        Dataset *dataset;
         unsigned int k = searchArguments->getK();
+
+        /* In case '-threads' was not provided every hardware thread is used */
+        unsigned int threads = searchArguments->getThreads();
+        if (threads == 0)
+            threads = Parallel::getHardwareThreads();
         unsigned int curveDimensions;
         unsigned int vectorDimensions;
 
@@ -68,58 +102,109 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
 
             curveDimensions = 1;
 
-            std::cout << "\nParsing Input file : '" << inputFilePath << "'..." << std::endl;
+            if (indexReader != nullptr)
+                inputCurves = AppliedSearch::loadCurves(*indexReader, curveDimensions, true);
+
+            else {
+
+                std::cout << "\nParsing Input file : '" << inputFilePath << "'..." << std::endl;
 
-            /* Parse the provided input file */
-            inputCurves = Parser::parseCurvesFile(inputFilePath, curveDimensions, 1.0, 0);
+                /* Parse the provided input file */
+                inputCurves = Parser::parseCurvesFile(inputFilePath, curveDimensions, 1.0, 0, threads);
+            }
 
             /* See Parser::parseCurvesFile for more  */
             if (inputCurves->empty()) {
                 delete inputCurves;
+                delete indexReader;
                 delete searchArguments;
                 delete vectorMetric;
-                std::cout << "Error : No valid Curves were found in '" << inputFilePath << "'" << std::endl;
+                if (indexReader != nullptr)
+                    std::cout << "Error : '" << loadIndexPath << "' is not a valid Index file" << std::endl;
+                else
+                    std::cout << "Error : No valid Curves were found in '" << inputFilePath << "'" << std::endl;
                 return;
             }
 
-            /* Get the vectorial representations of the just parsed Curves */
-            AppliedSearch::getVectorialRepresentations(*inputCurves, vectorialInputCurves);
+            /* Store the vectorial representations of the just parsed Curves contiguously */
+            dataset = Dataset::createDataset(*inputCurves, false);
+            const std::vector<Point *> &vectorialInputCurves = dataset->getPoints();
             vectorDimensions = vectorialInputCurves[0]->getDimensions();
 
-            /* Optimal w calculation. Percentage argument is 0 here due to the fact the provided Input/Query files are of a minimal size */
-            std::cout << "\nCalculating optimal w..." << std::endl;
-            w = Method::calculateOptimalWindow(0.0, vectorialInputCurves, vectorMetric);
-
             VectorMethod *vectorMethod;
 
-            /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
-            unsigned int threshold = (vectorialInputCurves.size() / 3) + 1;
+            if (indexReader != nullptr) {
+
+                if (algorithm == "LSH")
+                    vectorMethod = new VectorLSH(*indexReader, vectorialInputCurves);
+                else
+                    vectorMethod = new Hypercube(*indexReader, vectorialInputCurves);
+
+                if (!indexReader->isValid()) {
+                    delete vectorMethod;
+                    delete dataset;
+                    for (Curve *curve: *inputCurves)
+                        delete curve;
+                    delete inputCurves;
+                    delete indexReader;
+                    delete searchArguments;
+                    delete vectorMetric;
+                    std::cout << "Error : '" << loadIndexPath << "' is not a valid Index file" << std::endl;
+                    return;
+                }
+            }
 
-            if (algorithm == "LSH") {
+            else {
+
+                /* Optimal w calculation. Percentage argument is 0 here due to the fact the provided Input/Query files are of a minimal size */
+                std::cout << "\nCalculating optimal w..." << std::endl;
+                w = Method::calculateOptimalWindow(0.0, vectorialInputCurves, vectorMetric);
 
                 /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
-                unsigned int hashTableSize = (vectorialInputCurves.size() / 8) + 1;
+                threshold = (vectorialInputCurves.size() / 3) + 1;
+                initialCurveComplexity = inputCurves->at(0)->getComplexity();
 
-                vectorMethod = new VectorLSH(vectorDimensions, AppliedSearch::norm, k, w, searchArguments->getL(), hashTableSize, threshold);
-            }
+                if (algorithm == "LSH") {
 
-            else
-                vectorMethod = new Hypercube(vectorDimensions, AppliedSearch::norm, k, w, searchArguments->getProbes(), searchArguments->getM());
+                    /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
+                    unsigned int hashTableSize = (vectorialInputCurves.size() / 8) + 1;
 
+                    vectorMethod = new VectorLSH(vectorDimensions, AppliedSearch::norm, k, w, searchArguments->getL(), hashTableSize, threshold, searchArguments->getProbes());
+                }
 
-            /* Train the corresponding data structure */
-            std::cout << "\nInserting Curves in the Vector-" << algorithm << " data structure..." << std::endl;
-            for (Point *point: vectorialInputCurves)
-                vectorMethod->insertPoint(point);
+                else
+                    vectorMethod = new Hypercube(vectorDimensions, AppliedSearch::norm, k, w, searchArguments->getProbes(), searchArguments->getM());
 
-            bool keepExecuting = true;
-            int totalExecutions = 1;
 
-            std::ofstream outputFile;
+                /* Train the corresponding data structure */
+                std::cout << "\nInserting Curves in the Vector-" << algorithm << " data structure..." << std::endl;
+                vectorMethod->build(vectorialInputCurves, threads);
+
+                /* Write the Input Curves and the trained data structure, so that a following execution may load them with '-load-index' */
+                IndexWriter *indexWriter = AppliedSearch::createIndexWriter(searchArguments, algorithm, metric, w, threshold, delta, epsilon, initialCurveComplexity, *inputCurves);
+                if (indexWriter != nullptr) {
+                    vectorMethod->save(*indexWriter, vectorialInputCurves);
+                    AppliedSearch::closeIndexWriter(indexWriter, searchArguments);
+                }
+            }
+
+            /* In case '-ground-truth none' was provided no exact nearest neighbors are searched for, while in case of '-ground-truth cached' they are searched for only once */
+            bool hasGroundTruth = searchArguments->getGroundTruth() != "none";
+            GroundTruthCache *groundTruthCache = AppliedSearch::createGroundTruthCache(searchArguments, *inputCurves, metric);
+
+            /* In case '-stream' was provided the Query Curves are read from the stream instead of a Query file */
+            QueryStream *queryStream = AppliedSearch::createQueryStream(searchArguments, curveDimensions, initialCurveComplexity, threads);
+
+            bool keepExecuting = searchArguments->getStreamPath().empty() || queryStream != nullptr;
+            int totalExecutions = 1;
 
             do {
 
-                if (totalExecutions > 1) {
+                /* A stream of Queries is answered only once as it lasts until it is closed */
+                if (totalExecutions > 1 && queryStream != nullptr)
+                    keepExecuting = false;
+
+                else if (totalExecutions > 1) {
                     std::pair<bool, std::string> userDecision = AppliedSearch::requestDifferentQueryFilePath();
                     keepExecuting = userDecision.first;
                     queryFilePath = userDecision.second;
@@ -132,89 +217,119 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
                     double averageApproximateTime = 0.0;
                     double maximumApproximationFactor = std::numeric_limits<double>::min();
 
-                    outputFile.open(outputFilePath, std::ios::app);
+                    ResultWriter *resultWriter = ResultWriter::createResultWriter(outputFilePath, searchArguments->getOutputFormat());
 
-                    std::cout << "\nParsing Query file : '" << queryFilePath << "'..." << std::endl;
-
-                    /* Parse the provided query file. See Parser::parseCurvesFile on the inputCurves->at(0)->getComplexity() argument */
-                    std::vector<Curve *> *queryCurves = Parser::parseCurvesFile(queryFilePath, curveDimensions, 1.0, inputCurves->at(0)->getComplexity());
+                    if (resultWriter == nullptr) {
+                        std::cout << "Error : Could not open file " << outputFilePath << std::endl;
+                        break;
+                    }
 
                     std::cout << "\nApplying Vector-" << algorithm << "..." << std::endl;
 
                     /* Output execution parameters */
-                    outputFile << "\n\n--Execution parameters--";
+                    std::vector<std::pair<std::string, std::string>> parameters;
 
                     if (algorithm == "LSH") {
-                        outputFile << "\n\nAlgorithm : LSH_Vector";
-                        outputFile << "\nL : " + std::to_string(searchArguments->getL());
-                        outputFile << "\nk : " + std::to_string(searchArguments->getK());
-                        outputFile << "\nw : " + std::to_string(w);
-                        outputFile << "\nthreshold : " + std::to_string(threshold);
+                        parameters.emplace_back("Algorithm", "LSH_Vector");
+                        parameters.emplace_back("L", std::to_string(searchArguments->getL()));
+                        parameters.emplace_back("k", std::to_string(searchArguments->getK()));
+                        parameters.emplace_back("w", std::to_string(w));
+                        parameters.emplace_back("threshold", std::to_string(threshold));
+                        if (searchArguments->getProbes() > 0)
+                            parameters.emplace_back("probes", std::to_string(searchArguments->getProbes()));
                     }
                     else {
-                        outputFile << "\n\nAlgorithm : Hypercube";
-                        outputFile << "\nk : " + std::to_string(searchArguments->getK());
-                        outputFile << "\nM : " + std::to_string(searchArguments->getM());
-                        outputFile << "\nprobes : " + std::to_string(searchArguments->getProbes());
-                        outputFile << "\nw : " + std::to_string(w);
+                        parameters.emplace_back("Algorithm", "Hypercube");
+                        parameters.emplace_back("k", std::to_string(searchArguments->getK()));
+                        parameters.emplace_back("M", std::to_string(searchArguments->getM()));
+                        parameters.emplace_back("probes", std::to_string(searchArguments->getProbes()));
+                        parameters.emplace_back("w", std::to_string(w));
                     }
-                    outputFile.flush();
+                    resultWriter->writeParameters(parameters);
+                    resultWriter->flush();
+
+                    std::vector<Curve *> *queryCurves;
+
+                    /* A Query file is a single batch, while a stream of Queries is answered one batch at a time to bound the memory used */
+                    while ((queryCurves = AppliedSearch::nextQueryCurves(queryStream, queryFilePath, curveDimensions, initialCurveComplexity, threads)) != nullptr) {
+
+                        /* The Query Curves are answered concurrently against the read-only data structure and each result is stored at its Query's position */
+                        std::vector<std::tuple<Point *, distance_t, double>> approximateNearestNeighbors(queryCurves->size());
+                        std::vector<std::tuple<std::string, distance_t, double>> bruteForceNeighbors(queryCurves->size());
+                        std::vector<uint64_t> queryHashes(queryCurves->size(), 0);
+
+                        Parallel::parallelFor(queryCurves->size(), threads, [&](unsigned int i) {
 
-                    for (Curve *queryCurve: *queryCurves) {
+                            Point *queryPoint = queryCurves->at(i)->getVectorialRepresentation();
+                            approximateNearestNeighbors[i] = vectorMethod->getApproximateNearestNeighbor(queryPoint, vectorMetric);
 
-                        outputFile << "\n\nQuery : " + queryCurve->getID();
+                            /* The exact nearest neighbor is only searched for in case it was requested and it is not cached */
+                            if (!hasGroundTruth || AppliedSearch::findGroundTruth(groundTruthCache, *queryCurves->at(i), queryHashes[i], bruteForceNeighbors[i]))
+                                return;
 
-                        std::tuple<Point *, long double, double> approximateNearestNeighbor = vectorMethod->getApproximateNearestNeighbor(queryCurve->getVectorialRepresentation(), vectorMetric);
-                        std::tuple<Point *, long double, double> bruteForceNeighbor = vectorMethod->getExactNeighbor(queryCurve->getVectorialRepresentation(), vectorialInputCurves, vectorMetric);
+                            std::tuple<Point *, distance_t, double> bruteForceNeighbor = vectorMethod->getExactNeighbor(queryPoint, vectorialInputCurves, vectorMetric);
+                            bruteForceNeighbors[i] = std::make_tuple(std::get<0>(bruteForceNeighbor)->getCurve()->getID(), std::get<1>(bruteForceNeighbor), std::get<2>(bruteForceNeighbor));
+                        });
 
-                        Point *approximateNearestNeighborPoint = std::get<0>(approximateNearestNeighbor);
-                        long double approximateNearestNeighborDistance = std::get<1>(approximateNearestNeighbor);
-                        double approximateNearestNeighborDuration = std::get<2>(approximateNearestNeighbor);
+                        /* The results are written in the order of the Query file, interleaved with the records of the rejected lines of a stream */
+                        for (unsigned int i = 0; i < queryCurves->size(); ++i) {
 
-                        long double bruteForceNeighborDistance = std::get<1>(bruteForceNeighbor);
-                        double bruteForceNeighborDuration = std::get<2>(bruteForceNeighbor);
+                            AppliedSearch::writeRejectedQueries(queryStream, resultWriter, i);
 
-                        /* See README for more -- section Output file */
-                        if (approximateNearestNeighborPoint != nullptr)
-                            outputFile << "\nApproximate Nearest Neighbor : " + std::get<0>(approximateNearestNeighbor)->getCurve()->getID();
-                        else
-                            outputFile << "\nApproximate Nearest Neighbor : N/A";
+                            const std::tuple<Point *, distance_t, double> &approximateNearestNeighbor = approximateNearestNeighbors[i];
+                            const std::tuple<std::string, distance_t, double> &bruteForceNeighbor = bruteForceNeighbors[i];
 
-                        outputFile << "\nTrue Nearest Neighbor : " + std::get<0>(bruteForceNeighbor)->getCurve()->getID();
+                            Point *approximateNearestNeighborPoint = std::get<0>(approximateNearestNeighbor);
+                            distance_t approximateNearestNeighborDistance = std::get<1>(approximateNearestNeighbor);
+                            double approximateNearestNeighborDuration = std::get<2>(approximateNearestNeighbor);
 
-                        if (approximateNearestNeighborPoint != nullptr)
-                            outputFile << "\ndistanceApproximate : " + std::to_string(approximateNearestNeighborDistance);
-                        else
-                            outputFile << "\ndistanceApproximate : N/A";
+                            distance_t bruteForceNeighborDistance = std::get<1>(bruteForceNeighbor);
+                            double bruteForceNeighborDuration = std::get<2>(bruteForceNeighbor);
 
-                        outputFile << "\ndistanceTrue : " + std::to_string(bruteForceNeighborDistance);
+                            /* See README for more -- section Output file */
+                            std::string approximateNearestNeighborID;
+                            if (approximateNearestNeighborPoint != nullptr)
+                                approximateNearestNeighborID = approximateNearestNeighborPoint->getCurve()->getID();
 
-                        if (approximateNearestNeighborPoint != nullptr)
-                            outputFile << "\ntimeApproximate : " + std::to_string(approximateNearestNeighborDuration) + " ms";
-                        else
-                            outputFile << "\ntimeApproximate : N/A";
+                            resultWriter->writeResult(queryCurves->at(i)->getID(),
+                                                      approximateNearestNeighborPoint != nullptr ? &approximateNearestNeighborID : nullptr, approximateNearestNeighborDistance, approximateNearestNeighborDuration,
+                                                      hasGroundTruth ? &std::get<0>(bruteForceNeighbor) : nullptr, bruteForceNeighborDistance, bruteForceNeighborDuration);
 
-                        outputFile << "\ntimeTrue : " + std::to_string(bruteForceNeighborDuration) + " ms";
-                        outputFile.flush();
+                            if (groundTruthCache != nullptr)
+                                groundTruthCache->insert(queryHashes[i], bruteForceNeighbor);
 
 
-                        if (approximateNearestNeighborPoint != nullptr) {
+                            if (approximateNearestNeighborPoint != nullptr) {
 
-                            totalQueries += 1.0;
+                                totalQueries += 1.0;
 
-                            averageApproximateTime += approximateNearestNeighborDuration;
-                            averageTrueTime += bruteForceNeighborDuration;
+                                averageApproximateTime += approximateNearestNeighborDuration;
+                                averageTrueTime += bruteForceNeighborDuration;
 
-                            if (bruteForceNeighborDistance == approximateNearestNeighborDistance && maximumApproximationFactor < 1)
-                                maximumApproximationFactor = 1;
+                                if (!hasGroundTruth)
+                                    continue;
 
-                            else if (bruteForceNeighborDistance == 0.0 && approximateNearestNeighborDistance > 0)
-                                maximumApproximationFactor = std::numeric_limits<double>::max();
+                                if (bruteForceNeighborDistance == approximateNearestNeighborDistance && maximumApproximationFactor < 1)
+                                    maximumApproximationFactor = 1;
+
+                                else if (bruteForceNeighborDistance == 0.0 && approximateNearestNeighborDistance > 0)
+                                    maximumApproximationFactor = std::numeric_limits<double>::max();
+
+                                else if (approximateNearestNeighborDistance / bruteForceNeighborDistance > maximumApproximationFactor)
+                                    maximumApproximationFactor = approximateNearestNeighborDistance / bruteForceNeighborDistance;
+                            }
 
-                            else if (approximateNearestNeighborDistance / bruteForceNeighborDistance > maximumApproximationFactor)
-                                maximumApproximationFactor = approximateNearestNeighborDistance / bruteForceNeighborDistance;
                         }
 
+                        AppliedSearch::writeRejectedQueries(queryStream, resultWriter, queryCurves->size());
+
+                        for (Curve *queryCurve: *queryCurves)
+                            delete queryCurve;
+
+                        delete queryCurves;
+
+                        /* The results are only written to the Output file once per batch */
+                        resultWriter->flush();
                     }
 
                     /* Calculate the average approximate time and average true time based on the number of valid Queries */
@@ -223,34 +338,26 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
                         averageTrueTime /= totalQueries;
                     }
 
-                    outputFile << "\n\ntApproximateAverage : " + std::to_string(averageApproximateTime) + " ms";
-                    outputFile << "\ntApproximateTrue : " + std::to_string(averageTrueTime) + " ms";
+                    /* In case no valid Query Curves were found the maximum approximation factor remains std::numeric_limits<double>::min() and in case of a division by 0 it is std::numeric_limits<double>::max() */
+                    resultWriter->writeSummary(averageApproximateTime, averageTrueTime, hasGroundTruth, maximumApproximationFactor);
 
-                    /* In case no valid query Curves were found in the query file */
-                    if (maximumApproximationFactor == std::numeric_limits<double>::min())
-                        outputFile << "\nMAF : N/A";
-
-                    else if (maximumApproximationFactor != std::numeric_limits<double>::max())
-                        outputFile << "\nMAF : " + std::to_string(maximumApproximationFactor);
-
-                        /* In case of division by 0 */
-                    else
-                        outputFile << "\nMAF : +∞";
-
-
-                    for (Curve *queryCurve: *queryCurves)
-                        delete queryCurve;
-
-                    delete queryCurves;
+                    /* The exact nearest neighbors found during this execution are kept for the following ones */
+                    if (groundTruthCache != nullptr && !groundTruthCache->save())
+                        std::cout << "Error : Could not write file " << searchArguments->getGroundTruthCachePath() << std::endl;
 
                     totalExecutions++;
 
-                    outputFile.close();
+                    if (!resultWriter->flush())
+                        std::cout << "Error : Could not write file " << outputFilePath << std::endl;
+
+                    delete resultWriter;
                 }
 
             } while (keepExecuting);
 
 
+            delete groundTruthCache;
+            delete queryStream;
             delete vectorMethod;
         }
 
@@ -258,9 +365,6 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
 
             bool continuous;
             CurveMetric *curveMetric;
-            unsigned int initialCurveComplexity;
-            long double delta = searchArguments->getDelta();
-            long double epsilon = searchArguments->getEpsilon();
 
             if (metric == "discrete") {
                 curveDimensions = 2;
@@ -274,70 +378,121 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
                 curveMetric = new ContinuousFrechet();
             }
 
-            std::cout << "\nParsing Input file : '" << inputFilePath << "'..." << std::endl;
+            if (indexReader != nullptr)
+                inputCurves = AppliedSearch::loadCurves(*indexReader, curveDimensions, false);
+
+            else {
 
-            /* Parse the provided Input file */
-            inputCurves = Parser::parseCurvesFile(inputFilePath, curveDimensions, 1.0, 0);
+                std::cout << "\nParsing Input file : '" << inputFilePath << "'..." << std::endl;
+
+                /* Parse the provided Input file */
+                inputCurves = Parser::parseCurvesFile(inputFilePath, curveDimensions, 1.0, 0, threads);
+            }
 
             /* See Parser::parseCurvesFile for more */
             if (inputCurves->empty()) {
                 delete inputCurves;
+                delete indexReader;
                 delete searchArguments;
                 delete curveMetric;
                 delete vectorMetric;
-                std::cout << "\nError : No valid Curves were found in '" << inputFilePath << "'" << std::endl;
+                if (indexReader != nullptr)
+                    std::cout << "\nError : '" << loadIndexPath << "' is not a valid Index file" << std::endl;
+                else
+                    std::cout << "\nError : No valid Curves were found in '" << inputFilePath << "'" << std::endl;
                 return;
             }
 
-            /* initialCurveComplexity stores the Curve-dataset pre-filtering complexity in case of LSH_Frechet_Continuous */
-            initialCurveComplexity = inputCurves->at(0)->getComplexity();
-
-            /* In case delta was not provided */
-            if (delta == 0.0) {
-                delta = CurveMethod::calculateOptimalDelta(*inputCurves, curveDimensions, 5);
-                std::cout << "\nCalculating optimal delta..." << std::endl;
+            CurveMethod *curveMethod;
+
+            /* The Input Curves of an Index file have already been filtered, thus the data structure is read as is */
+            if (indexReader != nullptr) {
+
+                dataset = nullptr;
+                curveMethod = new CurveLSH(*indexReader, *inputCurves);
+
+                if (!indexReader->isValid()) {
+                    delete curveMethod;
+                    for (Curve *curve: *inputCurves)
+                        delete curve;
+                    delete inputCurves;
+                    delete indexReader;
+                    delete searchArguments;
+                    delete curveMetric;
+                    delete vectorMetric;
+                    std::cout << "\nError : '" << loadIndexPath << "' is not a valid Index file" << std::endl;
+                    return;
+                }
             }
 
-            /* Get the vectorial representations of the just parsed Input Curves */
-            AppliedSearch::getVectorialRepresentations(*inputCurves, vectorialInputCurves);
-            vectorDimensions = vectorialInputCurves[0]->getDimensions();
+            else {
 
-            /* Optimal w calculation. Percentage argument is 0 here due to the fact the provided Input/Query files are of a minimal size */
-            w = Method::calculateOptimalWindow(0.0, vectorialInputCurves, vectorMetric);
-            std::cout << "\nCalculating optimal w..." << std::endl;
+                /* initialCurveComplexity stores the Curve-dataset pre-filtering complexity in case of LSH_Frechet_Continuous */
+                initialCurveComplexity = inputCurves->at(0)->getComplexity();
 
-            /* Curve filtering */
-            if (metric == "continuous") {
+                /* In case delta was not provided */
+                if (delta == 0.0) {
+                    delta = CurveMethod::calculateOptimalDelta(*inputCurves, curveDimensions, 5);
+                    std::cout << "\nCalculating optimal delta..." << std::endl;
+                }
 
-                std::cout << "\nFiltering Input Curves..." << std::endl;
+                /* Store the vectorial representations of the just parsed Input Curves contiguously */
+                dataset = Dataset::createDataset(*inputCurves, false);
+                const std::vector<Point *> &vectorialInputCurves = dataset->getPoints();
+                vectorDimensions = vectorialInputCurves[0]->getDimensions();
 
-                for (Curve *curve: *inputCurves)
-                    curve->filter(epsilon);
-            }
+                /* Optimal w calculation. Percentage argument is 0 here due to the fact the provided Input/Query files are of a minimal size */
+                w = Method::calculateOptimalWindow(0.0, vectorialInputCurves, vectorMetric);
+                std::cout << "\nCalculating optimal w..." << std::endl;
 
+                /* Curve filtering */
+                if (metric == "continuous") {
 
-            /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
-            unsigned int hashTableSize = (vectorialInputCurves.size() / 8) + 1;
+                    std::cout << "\nFiltering Input Curves..." << std::endl;
 
-            /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
-            unsigned int threshold = (vectorialInputCurves.size() / 3) + 1;
+                    for (Curve *curve: *inputCurves)
+                        curve->filter(epsilon);
+                }
 
-            CurveMethod *curveMethod = new CurveLSH(vectorDimensions, AppliedSearch::norm, k, w, searchArguments->getL(), hashTableSize, threshold, curveDimensions, delta, continuous);
 
-            std::cout << "\nInserting Curves in the Curve-LSH data structure..." << std::endl;
+                /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
+                unsigned int hashTableSize = (vectorialInputCurves.size() / 8) + 1;
 
-            /* Train the CurveLSH data structure */
-            for (Curve *curve: *inputCurves)
-                curveMethod->insertCurve(curve);
+                /* (vectorialInputCurves.size() / x) + 1 in case (vectorialInputCurves.size() / x) == 0 */
+                threshold = (vectorialInputCurves.size() / 3) + 1;
 
-            bool keepExecuting = true;
-            int totalExecutions = 1;
+                curveMethod = new CurveLSH(vectorDimensions, AppliedSearch::norm, k, w, searchArguments->getL(), hashTableSize, threshold, curveDimensions, delta, continuous);
 
-            std::ofstream outputFile;
+                std::cout << "\nInserting Curves in the Curve-LSH data structure..." << std::endl;
+
+                /* Train the CurveLSH data structure */
+                curveMethod->build(*inputCurves, threads);
+
+                /* Write the filtered Input Curves and the trained data structure, so that a following execution may load them with '-load-index' */
+                IndexWriter *indexWriter = AppliedSearch::createIndexWriter(searchArguments, algorithm, metric, w, threshold, delta, epsilon, initialCurveComplexity, *inputCurves);
+                if (indexWriter != nullptr) {
+                    curveMethod->save(*indexWriter, *inputCurves);
+                    AppliedSearch::closeIndexWriter(indexWriter, searchArguments);
+                }
+            }
+
+            /* In case '-ground-truth none' was provided no exact nearest neighbors are searched for, while in case of '-ground-truth cached' they are searched for only once */
+            bool hasGroundTruth = searchArguments->getGroundTruth() != "none";
+            GroundTruthCache *groundTruthCache = AppliedSearch::createGroundTruthCache(searchArguments, *inputCurves, metric);
+
+            /* In case '-stream' was provided the Query Curves are read from the stream instead of a Query file */
+            QueryStream *queryStream = AppliedSearch::createQueryStream(searchArguments, curveDimensions, initialCurveComplexity, threads);
+
+            bool keepExecuting = searchArguments->getStreamPath().empty() || queryStream != nullptr;
+            int totalExecutions = 1;
 
             do {
 
-                if (totalExecutions > 1) {
+                /* A stream of Queries is answered only once as it lasts until it is closed */
+                if (totalExecutions > 1 && queryStream != nullptr)
+                    keepExecuting = false;
+
+                else if (totalExecutions > 1) {
                     std::pair<bool, std::string> userDecision = AppliedSearch::requestDifferentQueryFilePath();
                     keepExecuting = userDecision.first;
                     queryFilePath = userDecision.second;
@@ -350,100 +505,121 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
                     double averageApproximateTime = 0.0;
                     double maximumApproximationFactor = std::numeric_limits<double>::min();
 
-                    outputFile.open(outputFilePath, std::ios::app);
-
-                    std::cout << "\nParsing Query file : '" << queryFilePath << "'..." << std::endl;
+                    ResultWriter *resultWriter = ResultWriter::createResultWriter(outputFilePath, searchArguments->getOutputFormat());
 
-                    /* Parse the provided query file. See Parser::parseCurvesFile on the initialCurveComplexity argument */
-                    std::vector<Curve *> *queryCurves = Parser::parseCurvesFile(queryFilePath, curveDimensions, 1.0, initialCurveComplexity);
-
-
-                    /* Curve filtering */
-                    if (metric == "continuous") {
-
-                        std::cout << "\nFiltering Query Curves..." << std::endl;
-
-                        for (Curve *curve: *queryCurves)
-                            curve->filter(epsilon);
+                    if (resultWriter == nullptr) {
+                        std::cout << "Error : Could not open file " << outputFilePath << std::endl;
+                        break;
                     }
 
-
                     std::cout << "\nApplying Curve-LSH..." << std::endl;
 
                     /* Output the execution parameters */
-                    outputFile << "\n\n--Execution parameters--";
+                    std::vector<std::pair<std::string, std::string>> parameters;
 
                     if (metric == "discrete")
-                        outputFile << "\n\nAlgorithm : LSH_Frechet_Discrete";
+                        parameters.emplace_back("Algorithm", "LSH_Frechet_Discrete");
 
                     else
-                        outputFile << "\n\nAlgorithm : LSH_Frechet_Continuous";
+                        parameters.emplace_back("Algorithm", "LSH_Frechet_Continuous");
 
 
-                    outputFile << "\nL : " + std::to_string(searchArguments->getL());
-                    outputFile << "\nk : " + std::to_string(searchArguments->getK());
-                    outputFile << "\nw : " + std::to_string(w);
-                    outputFile << "\ndelta : " + std::to_string(delta);
-                    outputFile << "\nthreshold : " + std::to_string(threshold);
+                    parameters.emplace_back("L", std::to_string(searchArguments->getL()));
+                    parameters.emplace_back("k", std::to_string(searchArguments->getK()));
+                    parameters.emplace_back("w", std::to_string(w));
+                    parameters.emplace_back("delta", std::to_string(delta));
+                    parameters.emplace_back("threshold", std::to_string(threshold));
                     if (continuous)
-                        outputFile << "\nepsilon : " + std::to_string(epsilon);
-                    outputFile.flush();
+                        parameters.emplace_back("epsilon", std::to_string(epsilon));
+                    resultWriter->writeParameters(parameters);
+                    resultWriter->flush();
+
+                    std::vector<Curve *> *queryCurves;
+
+                    /* A Query file is a single batch, while a stream of Queries is answered one batch at a time to bound the memory used */
+                    while ((queryCurves = AppliedSearch::nextQueryCurves(queryStream, queryFilePath, curveDimensions, initialCurveComplexity, threads)) != nullptr) {
+
+                        /* Curve filtering */
+                        if (metric == "continuous")
+                            for (Curve *curve: *queryCurves)
+                                curve->filter(epsilon);
+
+                        /* The Query Curves are answered concurrently against the read-only data structure and each result is stored at its Query's position */
+                        std::vector<std::tuple<Curve *, distance_t, double>> approximateNearestNeighbors(queryCurves->size());
+                        std::vector<std::tuple<std::string, distance_t, double>> bruteForceNeighbors(queryCurves->size());
+                        std::vector<uint64_t> queryHashes(queryCurves->size(), 0);
+
+                        Parallel::parallelFor(queryCurves->size(), threads, [&](unsigned int i) {
+
+                            approximateNearestNeighbors[i] = curveMethod->getApproximateNearestNeighbor(queryCurves->at(i), curveMetric);
 
-                    for (Curve *queryCurve: *queryCurves) {
+                            /* The exact nearest neighbor is only searched for in case it was requested and it is not cached */
+                            if (!hasGroundTruth || AppliedSearch::findGroundTruth(groundTruthCache, *queryCurves->at(i), queryHashes[i], bruteForceNeighbors[i]))
+                                return;
 
-                        outputFile << "\n\nQuery : " + queryCurve->getID();
+                            std::tuple<Curve *, distance_t, double> bruteForceNeighbor = curveMethod->getExactNeighbor(queryCurves->at(i), *inputCurves, curveMetric);
+                            bruteForceNeighbors[i] = std::make_tuple(std::get<0>(bruteForceNeighbor)->getID(), std::get<1>(bruteForceNeighbor), std::get<2>(bruteForceNeighbor));
+                        });
 
-                        std::tuple<Curve *, long double, double> approximateNearestNeighbor = curveMethod->getApproximateNearestNeighbor(queryCurve, curveMetric);
-                        std::tuple<Curve *, long double, double> bruteForceNeighbor = curveMethod->getExactNeighbor(queryCurve, *inputCurves, curveMetric);
+                        /* The results are written in the order of the Query file, interleaved with the records of the rejected lines of a stream */
+                        for (unsigned int i = 0; i < queryCurves->size(); ++i) {
 
-                        Curve *approximateNearestNeighborCurve = std::get<0>(approximateNearestNeighbor);
-                        double approximateNearestNeighborDuration = std::get<2>(approximateNearestNeighbor);
-                        long double approximateNearestNeighborDistance = std::get<1>(approximateNearestNeighbor);
+                            AppliedSearch::writeRejectedQueries(queryStream, resultWriter, i);
 
-                        long double bruteForceNeighborDistance = std::get<1>(bruteForceNeighbor);
-                        double bruteForceNeighborDuration = std::get<2>(bruteForceNeighbor);
+                            const std::tuple<Curve *, distance_t, double> &approximateNearestNeighbor = approximateNearestNeighbors[i];
+                            const std::tuple<std::string, distance_t, double> &bruteForceNeighbor = bruteForceNeighbors[i];
 
-                        /* See README for more -- section Output file */
-                        if (approximateNearestNeighborCurve != nullptr)
-                            outputFile << "\nApproximate Nearest Neighbor : " + std::get<0>(approximateNearestNeighbor)->getID();
-                        else
-                            outputFile << "\nApproximate Nearest Neighbor : N/A";
+                            Curve *approximateNearestNeighborCurve = std::get<0>(approximateNearestNeighbor);
+                            double approximateNearestNeighborDuration = std::get<2>(approximateNearestNeighbor);
+                            distance_t approximateNearestNeighborDistance = std::get<1>(approximateNearestNeighbor);
 
-                        outputFile << "\nTrue Nearest Neighbor : " + std::get<0>(bruteForceNeighbor)->getID();
+                            distance_t bruteForceNeighborDistance = std::get<1>(bruteForceNeighbor);
+                            double bruteForceNeighborDuration = std::get<2>(bruteForceNeighbor);
 
-                        if (approximateNearestNeighborCurve != nullptr)
-                            outputFile << "\ndistanceApproximate : " + std::to_string(approximateNearestNeighborDistance);
-                        else
-                            outputFile << "\ndistanceApproximate : N/A";
+                            /* See README for more -- section Output file */
+                            std::string approximateNearestNeighborID;
+                            if (approximateNearestNeighborCurve != nullptr)
+                                approximateNearestNeighborID = approximateNearestNeighborCurve->getID();
 
-                        outputFile << "\ndistanceTrue : " + std::to_string(bruteForceNeighborDistance);
+                            resultWriter->writeResult(queryCurves->at(i)->getID(),
+                                                      approximateNearestNeighborCurve != nullptr ? &approximateNearestNeighborID : nullptr, approximateNearestNeighborDistance, approximateNearestNeighborDuration,
+                                                      hasGroundTruth ? &std::get<0>(bruteForceNeighbor) : nullptr, bruteForceNeighborDistance, bruteForceNeighborDuration);
 
-                        if (approximateNearestNeighborCurve != nullptr)
-                            outputFile << "\ntimeApproximate : " + std::to_string(approximateNearestNeighborDuration) + " ms";
-                        else
-                            outputFile << "\ntimeApproximate : N/A";
+                            if (groundTruthCache != nullptr)
+                                groundTruthCache->insert(queryHashes[i], bruteForceNeighbor);
 
-                        outputFile << "\ntimeTrue : " + std::to_string(bruteForceNeighborDuration) + " ms";
-                        outputFile.flush();
+                            if (approximateNearestNeighborCurve != nullptr) {
 
-                        if (approximateNearestNeighborCurve != nullptr) {
+                                totalQueries += 1.0;
 
-                            totalQueries += 1.0;
+                                averageApproximateTime += approximateNearestNeighborDuration;
+                                averageTrueTime += bruteForceNeighborDuration;
 
-                            averageApproximateTime += approximateNearestNeighborDuration;
-                            averageTrueTime += bruteForceNeighborDuration;
+                                if (!hasGroundTruth)
+                                    continue;
 
-                            if (bruteForceNeighborDistance == approximateNearestNeighborDistance && maximumApproximationFactor < 1)
-                                maximumApproximationFactor = 1;
+                                if (bruteForceNeighborDistance == approximateNearestNeighborDistance && maximumApproximationFactor < 1)
+                                    maximumApproximationFactor = 1;
 
-                            else if (bruteForceNeighborDistance == 0.0 && approximateNearestNeighborDistance > 0)
-                                maximumApproximationFactor = std::numeric_limits<double>::max();
+                                else if (bruteForceNeighborDistance == 0.0 && approximateNearestNeighborDistance > 0)
+                                    maximumApproximationFactor = std::numeric_limits<double>::max();
 
-                            else if (approximateNearestNeighborDistance / bruteForceNeighborDistance > maximumApproximationFactor)
-                                maximumApproximationFactor = approximateNearestNeighborDistance / bruteForceNeighborDistance;
+                                else if (approximateNearestNeighborDistance / bruteForceNeighborDistance > maximumApproximationFactor)
+                                    maximumApproximationFactor = approximateNearestNeighborDistance / bruteForceNeighborDistance;
+
+                            }
 
                         }
 
+                        AppliedSearch::writeRejectedQueries(queryStream, resultWriter, queryCurves->size());
+
+                        for (Curve *queryCurve: *queryCurves)
+                            delete queryCurve;
+
+                        delete queryCurves;
+
+                        /* The results are only written to the Output file once per batch */
+                        resultWriter->flush();
                     }
 
                     /* Calculate the average approximate time and average true time based on the number of valid Queries */
@@ -452,41 +628,35 @@ void AppliedSearch::appliedSearch(int argc, char **argv) {
                         averageTrueTime /= totalQueries;
                     }
 
-                    outputFile << "\n\ntApproximateAverage : " + std::to_string(averageApproximateTime) + " ms";
-                    outputFile << "\ntApproximateTrue : " + std::to_string(averageTrueTime) + " ms";
-
-                    /* In case no valid Query Curves were found in the Query file */
-                    if (maximumApproximationFactor == std::numeric_limits<double>::min())
-                        outputFile << "\nMAF : N/A";
-
-                    else if (maximumApproximationFactor != std::numeric_limits<double>::max())
-                        outputFile << "\nMAF : " + std::to_string(maximumApproximationFactor);
-
-                        /* In case of a division by 0 */
-                    else
-                        outputFile << "\nMAF : +∞";
-
-                    for (Curve *queryCurve: *queryCurves)
-                        delete queryCurve;
-
-                    delete queryCurves;
+                    /* In case no valid Query Curves were found the maximum approximation factor remains std::numeric_limits<double>::min() and in case of a division by 0 it is std::numeric_limits<double>::max() */
+                    resultWriter->writeSummary(averageApproximateTime, averageTrueTime, hasGroundTruth, maximumApproximationFactor);
 
+                    /* The exact nearest neighbors found during this execution are kept for the following ones */
+                    if (groundTruthCache != nullptr && !groundTruthCache->save())
+                        std::cout << "Error : Could not write file " << searchArguments->getGroundTruthCachePath() << std::endl;
                     totalExecutions++;
 
-                    outputFile.close();
+                    if (!resultWriter->flush())
+                        std::cout << "Error : Could not write file " << outputFilePath << std::endl;
+
+                    delete resultWriter;
                 }
 
             } while (keepExecuting);
 
+            delete groundTruthCache;
+            delete queryStream;
             delete curveMetric;
             delete curveMethod;
         }
 
 
+        delete dataset;
         for (Curve *curve: *inputCurves)
             delete curve;
         delete inputCurves;
         delete vectorMetric;
+        delete indexReader;
         delete searchArguments;
 
     }
@@ -502,7 +672,7 @@ std::string AppliedSearch::requestInputFilePath() {
         std::cout << "\nProvide the path of the Input File : ";
         std::getline(std::cin, inputFilePath);
         std::cout << std::endl;
-    } while (!File::canOpenFile(inputFilePath) || File::isFileEmpty(inputFilePath) || File::isInWindowsFormat(inputFilePath));
+    } while (!File::canOpenFile(inputFilePath) || File::isFileEmpty(inputFilePath) || (!Parser::isBinaryCurvesFile(inputFilePath) && File::isInWindowsFormat(inputFilePath)));
 
     return inputFilePath;
 }
@@ -532,7 +702,7 @@ std::string AppliedSearch::requestQueryFilePath() {
         std::cout << "\nProvide the path of the Query File : ";
         std::getline(std::cin, queryFilePath);
         std::cout << std::endl;
-    } while (!File::canOpenFile(queryFilePath) || File::isFileEmpty(queryFilePath) || File::isInWindowsFormat(queryFilePath));
+    } while (!File::canOpenFile(queryFilePath) || File::isFileEmpty(queryFilePath) || (!Parser::isBinaryCurvesFile(queryFilePath) && File::isInWindowsFormat(queryFilePath)));
 
     return queryFilePath;
 }
@@ -607,10 +777,188 @@ std::pair<bool, std::string> AppliedSearch::requestDifferentQueryFilePath() {
             std::cout << "\nProvide the path of the Query File : ";
             std::getline(std::cin, userInput);
             std::cout << std::endl;
-        } while (!File::canOpenFile(userInput) || File::isFileEmpty(userInput) || File::isInWindowsFormat(userInput));
+        } while (!File::canOpenFile(userInput) || File::isFileEmpty(userInput) || (!Parser::isBinaryCurvesFile(userInput) && File::isInWindowsFormat(userInput)));
 
 
     return std::make_pair(true, userInput);
 
 }
 
+/* Utility function to create the QueryStream provided by '-stream', whose batches hold a few Queries per thread
+ * It returns nullptr in case '-stream' was not provided or the stream could not be opened */
+QueryStream *AppliedSearch::createQueryStream(SearchArguments *searchArguments, unsigned int curveDimensions, unsigned int initialCurveComplexity, unsigned int threads) {
+
+    if (searchArguments->getStreamPath().empty())
+        return nullptr;
+
+    QueryStream *queryStream = QueryStream::createQueryStream(searchArguments->getStreamPath(), curveDimensions, 1.0, initialCurveComplexity, threads * AppliedSearch::STREAM_BATCH_SIZE_PER_THREAD);
+
+    if (queryStream == nullptr)
+        std::cout << "\nError : Could not open '" << searchArguments->getStreamPath() << "'" << std::endl;
+    else
+        std::cout << "\nStreaming Queries from '" << searchArguments->getStreamPath() << "'..." << std::endl;
+
+    return queryStream;
+}
+
+/* Utility function to get the next batch of Query Curves, which returns nullptr once there are no more Queries
+ * Without a QueryStream the whole Query file is parsed as the first and only batch, thus queryFilePath is cleared. See Parser::parseCurvesFile on the initialCurveComplexity argument */
+std::vector<Curve *> *AppliedSearch::nextQueryCurves(QueryStream *queryStream, std::string &queryFilePath, unsigned int curveDimensions, unsigned int initialCurveComplexity, unsigned int threads) {
+
+    if (queryStream != nullptr)
+        return queryStream->nextBatch();
+
+    if (queryFilePath.empty())
+        return nullptr;
+
+    std::cout << "\nParsing Query file : '" << queryFilePath << "'..." << std::endl;
+
+    std::vector<Curve *> *queryCurves = Parser::parseCurvesFile(queryFilePath, curveDimensions, 1.0, initialCurveComplexity, threads);
+    queryFilePath.clear();
+
+    return queryCurves;
+}
+
+/* Utility function to write an error record for each rejected line of the QueryStream's last batch that was read right after its first position Query Curves
+ * Thus a consumer of the Output file gets exactly one record per line of the stream, in the order of the stream */
+void AppliedSearch::writeRejectedQueries(const QueryStream *queryStream, ResultWriter *resultWriter, unsigned int position) {
+
+    if (queryStream == nullptr)
+        return;
+
+    for (const std::pair<unsigned int, std::string> &rejectedLine: queryStream->getRejectedLines())
+        if (rejectedLine.first == position)
+            resultWriter->writeError(rejectedLine.second, "Invalid Query");
+}
+
+/* Utility function to create the GroundTruthCache provided by '-ground-truth-cache' for the given Input Curves and metric, which is empty for the Vector algorithms
+ * It returns nullptr in case '-ground-truth cached' was not provided */
+GroundTruthCache *AppliedSearch::createGroundTruthCache(SearchArguments *searchArguments, const std::vector<Curve *> &inputCurves, const std::string &metric) {
+
+    if (searchArguments->getGroundTruth() != "cached")
+        return nullptr;
+
+    GroundTruthCache *groundTruthCache = GroundTruthCache::createGroundTruthCache(searchArguments->getGroundTruthCachePath(), inputCurves, metric);
+
+    std::cout << "\nLoaded " << groundTruthCache->getSize() << " cached exact nearest neighbors from '" << searchArguments->getGroundTruthCachePath() << "'..." << std::endl;
+
+    return groundTruthCache;
+}
+
+/* Utility function to look up the exact nearest neighbor of a Query Curve in the GroundTruthCache, if there is one, which stores the Query's hash value for the following insertion
+ * It returns true on a cache hit */
+bool AppliedSearch::findGroundTruth(const GroundTruthCache *groundTruthCache, const Curve &queryCurve, uint64_t &queryHash, std::tuple<std::string, distance_t, double> &bruteForceNeighbor) {
+
+    if (groundTruthCache == nullptr)
+        return false;
+
+    queryHash = GroundTruthCache::hashCurve(queryCurve);
+
+    return groundTruthCache->find(queryHash, bruteForceNeighbor);
+}
+
+/* Utility function to get the algorithm of an Index file given its kind, or an empty std::string in case the kind is invalid */
+std::string AppliedSearch::getIndexAlgorithm(uint32_t kind) {
+
+    if (kind == AppliedSearch::LSH_INDEX)
+        return "LSH";
+
+    else if (kind == AppliedSearch::HYPERCUBE_INDEX)
+        return "Hypercube";
+
+    else if (kind == AppliedSearch::FRECHET_INDEX)
+        return "Frechet";
+
+    return "";
+}
+
+/* Utility function to create the Index file provided by '-save-index' and write the parameters of the execution alongside the Input Curves
+ * The data structure should be written by the caller, which then calls AppliedSearch::closeIndexWriter. It returns nullptr in case '-save-index' was not provided or the file could not be created */
+IndexWriter *AppliedSearch::createIndexWriter(SearchArguments *searchArguments, const std::string &algorithm, const std::string &metric, unsigned int w, unsigned int threshold, coordinate_t delta, coordinate_t epsilon, unsigned int initialCurveComplexity, const std::vector<Curve *> &inputCurves) {
+
+    if (searchArguments->getSaveIndexPath().empty())
+        return nullptr;
+
+    std::cout << "\nWriting Index file : '" << searchArguments->getSaveIndexPath() << "'..." << std::endl;
+
+    uint32_t kind = AppliedSearch::FRECHET_INDEX;
+    if (algorithm == "LSH")
+        kind = AppliedSearch::LSH_INDEX;
+    else if (algorithm == "Hypercube")
+        kind = AppliedSearch::HYPERCUBE_INDEX;
+
+    IndexWriter *indexWriter = IndexWriter::createIndexWriter(searchArguments->getSaveIndexPath(), kind);
+
+    if (indexWriter == nullptr) {
+        std::cout << "Error : Could not create file " << searchArguments->getSaveIndexPath() << std::endl;
+        return nullptr;
+    }
+
+    indexWriter->writeString(metric);
+    indexWriter->writeValue<uint32_t>(searchArguments->getK());
+    indexWriter->writeValue<uint32_t>(searchArguments->getL());
+    indexWriter->writeValue<uint32_t>(searchArguments->getM());
+    indexWriter->writeValue<uint32_t>(searchArguments->getProbes());
+    indexWriter->writeValue<uint32_t>(w);
+    indexWriter->writeValue<uint32_t>(threshold);
+    indexWriter->writeValue<uint32_t>(initialCurveComplexity);
+    indexWriter->writeValue<coordinate_t>(delta);
+    indexWriter->writeValue<coordinate_t>(epsilon);
+
+    indexWriter->writeValue<uint64_t>(inputCurves.size());
+    for (Curve *curve: inputCurves)
+        curve->save(*indexWriter);
+
+    return indexWriter;
+}
+
+/* Utility function to report whether every value was written to the Index file and close it */
+void AppliedSearch::closeIndexWriter(IndexWriter *indexWriter, SearchArguments *searchArguments) {
+
+    if (!indexWriter->isValid())
+        std::cout << "Error : Could not write file " << searchArguments->getSaveIndexPath() << std::endl;
+
+    delete indexWriter;
+}
+
+/* Utility function to read the parameters written by AppliedSearch::createIndexWriter. The numeric parameters of the data structure are stored in searchArguments */
+void AppliedSearch::loadParameters(IndexReader &indexReader, SearchArguments *searchArguments, std::string &metric, unsigned int &w, unsigned int &threshold, coordinate_t &delta, coordinate_t &epsilon, unsigned int &initialCurveComplexity) {
+
+    metric = indexReader.readString();
+    searchArguments->setK(indexReader.readValue<uint32_t>());
+    searchArguments->setL(indexReader.readValue<uint32_t>());
+    searchArguments->setM(indexReader.readValue<uint32_t>());
+    searchArguments->setProbes(indexReader.readValue<uint32_t>());
+    w = indexReader.readValue<uint32_t>();
+    threshold = indexReader.readValue<uint32_t>();
+    initialCurveComplexity = indexReader.readValue<uint32_t>();
+    delta = indexReader.readValue<coordinate_t>();
+    epsilon = indexReader.readValue<coordinate_t>();
+}
+
+/* Utility function to read the Input Curves written by AppliedSearch::createIndexWriter
+ * Every Curve should be of the given dimensions and - if requested - of the same complexity, otherwise the IndexReader is invalidated and an empty std::vector is returned */
+std::vector<Curve *> *AppliedSearch::loadCurves(IndexReader &indexReader, unsigned int curveDimensions, bool equalComplexities) {
+
+    std::vector<Curve *> *inputCurves = new std::vector<Curve *>;
+
+    uint64_t totalCurves = indexReader.readValue<uint64_t>();
+    for (uint64_t i = 0; i < totalCurves && indexReader.isValid(); ++i) {
+
+        Curve *curve = Curve::createCurve(indexReader);
+
+        if (curve != nullptr)
+            inputCurves->push_back(curve);
+
+        if (curve != nullptr && (curve->getDimensions() != curveDimensions || curve->getComplexity() == 0 || (equalComplexities && curve->getComplexity() != inputCurves->at(0)->getComplexity())))
+            indexReader.invalidate();
+    }
+
+    if (!indexReader.isValid()) {
+        for (Curve *curve: *inputCurves)
+            delete curve;
+        inputCurves->clear();
+    }
+
+    return inputCurves;
+}
@@ -2,21 +2,42 @@
 #define APPLIEDSEARCH_H
 
 #include <string>
+#include <cstdint>
 #include "../../Curve-Modules/Curve/Curve.h"
 #include "../../CMD-Modules/Search-Arguments/SearchArguments.h"
+#include "../../Utilities/Index-Writer/IndexWriter.h"
+#include "../../Utilities/Index-Reader/IndexReader.h"
+#include "../../Utilities/Query-Stream/QueryStream.h"
+#include "../../Utilities/Ground-Truth-Cache/GroundTruthCache.h"
+#include "../../Utilities/Result-Writer/ResultWriter.h"
 
 class AppliedSearch {
 
 private:
 
-    static const long double norm;
+    static const double norm;
+    /* The kinds of Index files, one for each algorithm */
+    static const uint32_t LSH_INDEX;
+    static const uint32_t HYPERCUBE_INDEX;
+    static const uint32_t FRECHET_INDEX;
+    static const unsigned int STREAM_BATCH_SIZE_PER_THREAD;
+
     static std::string requestInputFilePath();
     static std::string requestAlgorithm(SearchArguments *);
     static std::string requestFrechetMetric(SearchArguments *searchArguments);
     static std::string requestOutputFilePath();
     static std::string requestQueryFilePath();
     static std::pair<bool, std::string> requestDifferentQueryFilePath();
-    static void getVectorialRepresentations(const std::vector<Curve *> &, std::vector<Point *> &);
+    static std::string getIndexAlgorithm(uint32_t);
+    static IndexWriter *createIndexWriter(SearchArguments *, const std::string &, const std::string &, unsigned int, unsigned int, coordinate_t, coordinate_t, unsigned int, const std::vector<Curve *> &);
+    static void closeIndexWriter(IndexWriter *, SearchArguments *);
+    static void loadParameters(IndexReader &, SearchArguments *, std::string &, unsigned int &, unsigned int &, coordinate_t &, coordinate_t &, unsigned int &);
+    static std::vector<Curve *> *loadCurves(IndexReader &, unsigned int, bool);
+    static QueryStream *createQueryStream(SearchArguments *, unsigned int, unsigned int, unsigned int);
+    static std::vector<Curve *> *nextQueryCurves(QueryStream *, std::string &, unsigned int, unsigned int, unsigned int);
+    static void writeRejectedQueries(const QueryStream *, ResultWriter *, unsigned int);
+    static GroundTruthCache *createGroundTruthCache(SearchArguments *, const std::vector<Curve *> &, const std::string &);
+    static bool findGroundTruth(const GroundTruthCache *, const Curve &, uint64_t &, std::tuple<std::string, distance_t, double> &);
 
     public:
 
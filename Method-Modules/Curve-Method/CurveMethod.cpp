@@ -1,14 +1,57 @@
 #include <chrono>
+#include <unordered_map>
 #include "CurveMethod.h"
+#include "../../Utilities/Bounded-Heap/BoundedHeap.h"
 
-CurveMethod::CurveMethod(unsigned int dimensions, long double norm, unsigned int k, unsigned int w) : Method(dimensions, norm, k, w) {}
+CurveMethod::CurveMethod(unsigned int dimensions, double norm, unsigned int k, unsigned int w) : Method(dimensions, norm, k, w) {}
+
+CurveMethod::CurveMethod(IndexReader &indexReader) : Method(indexReader) {}
 
 CurveMethod::~CurveMethod() {}
 
+/* Utility function to write the given Curves as their positions in the given dataset, which should contain every one of them */
+void CurveMethod::saveCurves(IndexWriter &indexWriter, const std::vector<Curve *> &curves, const std::vector<Curve *> &dataset) {
+
+    std::unordered_map<const Curve *, uint32_t> positions;
+    for (unsigned int i = 0; i < dataset.size(); ++i)
+        positions[dataset[i]] = i;
+
+    std::vector<uint32_t> indices;
+    for (Curve *curve: curves)
+        indices.push_back(positions.at(curve));
+
+    indexWriter.writeArray(indices);
+}
+
+/* Utility function to read the Curves written by CurveMethod::saveCurves from the given dataset and append them to curves */
+void CurveMethod::loadCurves(IndexReader &indexReader, const std::vector<Curve *> &dataset, std::vector<Curve *> &curves) {
+
+    std::vector<uint32_t> indices;
+    indexReader.readArray(indices);
+
+    for (uint32_t index: indices) {
+
+        if (index >= dataset.size()) {
+            indexReader.invalidate();
+            return;
+        }
+
+        curves.push_back(dataset[index]);
+    }
+}
+
+/* Function to insert the given Curves using at most the given number of threads
+ * Derived classes may override it to insert the Curves in bulk more efficiently, otherwise the Curves are inserted one by one */
+void CurveMethod::build(const std::vector<Curve *> &curves, unsigned int) {
+
+    for (Curve *curve: curves)
+        this->insertCurve(curve);
+}
+
 /* Utility function to get the exact neighbor of a Curve given a set of Curves and a Curve metric */
-std::tuple<Curve *, long double, double> CurveMethod::getExactNeighbor(Curve *const queryCurve, const std::vector<Curve *> &inputCurves, CurveMetric *curveMetric) {
+std::tuple<Curve *, distance_t, double> CurveMethod::getExactNeighbor(Curve *const queryCurve, const std::vector<Curve *> &inputCurves, CurveMetric *curveMetric) {
 
-    long double minDistance = std::numeric_limits<long double>::max();
+    distance_t minDistance = std::numeric_limits<distance_t>::max();
     Curve *nearestNeighbor = nullptr;
 
     /* Start the clock */
@@ -16,7 +59,8 @@ std::tuple<Curve *, long double, double> CurveMethod::getExactNeighbor(Curve *co
 
     for (Curve *curve: inputCurves) {
 
-        long double distanceToQueryCurve = curveMetric->distance(*queryCurve, *curve);
+        /* A Curve farther than the current nearest neighbor is rejected as soon as possible */
+        distance_t distanceToQueryCurve = curveMetric->boundedDistance(*queryCurve, *curve, minDistance);
 
         if (distanceToQueryCurve < minDistance) {
 
@@ -35,8 +79,19 @@ std::tuple<Curve *, long double, double> CurveMethod::getExactNeighbor(Curve *co
     return std::make_tuple(nearestNeighbor, minDistance, std::chrono::duration<double, std::milli>(duration).count());
 }
 
+/* Utility function to get the exact k nearest neighbors of a Curve given a set of Curves and a Curve metric, sorted in ascending order of their distances */
+std::vector<std::pair<Curve *, distance_t>> *CurveMethod::getExactKNearestNeighbors(Curve *const queryCurve, unsigned int k, const std::vector<Curve *> &inputCurves, CurveMetric *curveMetric) {
+
+    BoundedHeap<Curve *> nearestNeighbors(k);
+
+    for (Curve *curve: inputCurves)
+        nearestNeighbors.push(curve, curveMetric->boundedDistance(*queryCurve, *curve, nearestNeighbors.getWorstDistance()));
+
+    return nearestNeighbors.toSortedVector();
+}
+
 /* The following function calculates the optimal delta of a grid */
-long double CurveMethod::calculateOptimalDelta(const std::vector<Curve *> &inputCurves, unsigned int gridDimensions, unsigned int exponent) {
+coordinate_t CurveMethod::calculateOptimalDelta(const std::vector<Curve *> &inputCurves, unsigned int gridDimensions, unsigned int exponent) {
 
     unsigned minComplexity = std::numeric_limits<unsigned int>::max();
     for (Curve *curve: inputCurves)
@@ -44,8 +99,8 @@ long double CurveMethod::calculateOptimalDelta(const std::vector<Curve *> &input
             minComplexity = curve->getComplexity();
 
 
-    long double delta = 4 * gridDimensions * minComplexity;
+    coordinate_t delta = 4 * gridDimensions * minComplexity;
 
-    return delta / powl(10, (long double) exponent);
+    return delta / std::pow(10.0, exponent);
 
 }
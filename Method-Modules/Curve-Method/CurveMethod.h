@@ -9,17 +9,27 @@
 
 class CurveMethod : public Method {
 
+protected:
+    CurveMethod(IndexReader &);
+    static void saveCurves(IndexWriter &, const std::vector<Curve *> &, const std::vector<Curve *> &);
+    static void loadCurves(IndexReader &, const std::vector<Curve *> &, std::vector<Curve *> &);
 
 public:
-    CurveMethod(unsigned int, long double, unsigned int, unsigned int);
+    CurveMethod(unsigned int, double, unsigned int, unsigned int);
     virtual ~CurveMethod();
+    /* Pure virtual function as each derived class stores a different data structure. The inserted Curves are stored by their position in the given dataset */
+    virtual void save(IndexWriter &, const std::vector<Curve *> &) const = 0;
     /* Pure virtual function as each derived class may insert a Curve in a different way */
     virtual void insertCurve(Curve *const) = 0;
-    virtual std::tuple<Curve *, long double, double> getExactNeighbor(Curve *const, const std::vector<Curve *> &, CurveMetric *);
+    virtual void build(const std::vector<Curve *> &, unsigned int);
+    virtual std::tuple<Curve *, distance_t, double> getExactNeighbor(Curve *const, const std::vector<Curve *> &, CurveMetric *);
     /* Pure virtual function as each derived class may perform range search in a different way */
-    virtual std::tuple<Curve *, long double, double> getApproximateNearestNeighbor(Curve *const, CurveMetric *) = 0;
-    virtual std::vector<Curve *> *rangeSearch(Curve *const, long double, CurveMetric *) = 0;
-    static long double calculateOptimalDelta(const std::vector<Curve *> &, unsigned int, unsigned int);
+    virtual std::tuple<Curve *, distance_t, double> getApproximateNearestNeighbor(Curve *const, CurveMetric *) = 0;
+    virtual std::vector<Curve *> *rangeSearch(Curve *const, distance_t, CurveMetric *) = 0;
+    /* Pure virtual function as each derived class may collect the candidate neighbors in a different way */
+    virtual std::vector<std::pair<Curve *, distance_t>> *getKNearestNeighbors(Curve *const, unsigned int, CurveMetric *) = 0;
+    virtual std::vector<std::pair<Curve *, distance_t>> *getExactKNearestNeighbors(Curve *const, unsigned int, const std::vector<Curve *> &, CurveMetric *);
+    static coordinate_t calculateOptimalDelta(const std::vector<Curve *> &, unsigned int, unsigned int);
 
 };
 
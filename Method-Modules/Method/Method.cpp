@@ -3,7 +3,7 @@
 
 const unsigned int Method::DEFAULT_W = 6;
 
-Method::Method(unsigned int dimensions, long double norm, unsigned int k, unsigned int w) {
+Method::Method(unsigned int dimensions, double norm, unsigned int k, unsigned int w) {
 
     this->dimensions = dimensions;
     this->norm = norm;
@@ -13,8 +13,25 @@ Method::Method(unsigned int dimensions, long double norm, unsigned int k, unsign
         this->w = Method::DEFAULT_W;
 }
 
+/* Constructor that reads the parameters written by Method::save */
+Method::Method(IndexReader &indexReader) {
+
+    this->dimensions = indexReader.readValue<uint32_t>();
+    this->norm = indexReader.readValue<double>();
+    this->k = indexReader.readValue<uint32_t>();
+    this->w = indexReader.readValue<uint32_t>();
+}
+
 Method::~Method() {}
 
+void Method::save(IndexWriter &indexWriter) const {
+
+    indexWriter.writeValue<uint32_t>(this->dimensions);
+    indexWriter.writeValue<double>(this->norm);
+    indexWriter.writeValue<uint32_t>(this->k);
+    indexWriter.writeValue<uint32_t>(this->w);
+}
+
 /* The following function calculates the optimal window of h_i() */
 unsigned int Method::calculateOptimalWindow(double percentage, const std::vector<Point *> &inputPoints, VectorMetric *vectorMetric) {
 
@@ -28,21 +45,26 @@ unsigned int Method::calculateOptimalWindow(double percentage, const std::vector
     if (totalPoints == 0 || totalPoints > inputPoints.size())
         totalPoints = inputPoints.size() / 2;
 
-    long double averageOfAverages = 0;
+    distance_t averageOfAverages = 0;
+
+    /* Calculate the distance matrix of the first totalPoints Points */
+    std::vector<Point *> points(inputPoints.begin(), inputPoints.begin() + totalPoints);
+    std::vector<distance_t> distances;
+    vectorMetric->distances(points, points, distances);
 
     for (unsigned int i = 0; i < totalPoints; ++i) {
 
-        long double pointAverageDistance = 0;
+        distance_t pointAverageDistance = 0;
         for (unsigned int j = 0; j < totalPoints; ++j)
             if (j != i)
-                pointAverageDistance += vectorMetric->distance(*inputPoints.at(i), *inputPoints.at(j));
+                pointAverageDistance += distances[i * totalPoints + j];
 
-        averageOfAverages += (pointAverageDistance / (long double) totalPoints);
+        averageOfAverages += (pointAverageDistance / (distance_t) totalPoints);
     }
 
 
-    if ((averageOfAverages / (long double) totalPoints) > 0)
-        return (unsigned int) (averageOfAverages / (long double) totalPoints);
+    if ((averageOfAverages / (distance_t) totalPoints) > 0)
+        return (unsigned int) (averageOfAverages / (distance_t) totalPoints);
 
     else
         return Method::DEFAULT_W;
@@ -4,6 +4,8 @@
 #include <vector>
 #include "../../Vector-Modules/Point/Point.h"
 #include "../../Metric-Modules/Vector-Metric/VectorMetric.h"
+#include "../../Utilities/Index-Writer/IndexWriter.h"
+#include "../../Utilities/Index-Reader/IndexReader.h"
 
 /* Base class for VectorMethod and CurveMethod */
 
@@ -14,12 +16,15 @@ private:
 
 protected:
     unsigned int dimensions;
-    long double norm;
+    double norm;
     unsigned int k;
     unsigned int w;
 
+    explicit Method(IndexReader &);
+    void save(IndexWriter &) const;
+
 public:
-    Method(unsigned int, long double, unsigned int, unsigned int);
+    Method(unsigned int, double, unsigned int, unsigned int);
     virtual ~Method();
     static unsigned int calculateOptimalWindow(double, const std::vector<Point *> &, VectorMetric *);
     unsigned int getVectorSpaceDimensions() const;
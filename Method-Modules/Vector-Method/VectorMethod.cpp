@@ -1,30 +1,73 @@
 #include <chrono>
+#include <unordered_map>
 #include "VectorMethod.h"
+#include "../../Utilities/Bounded-Heap/BoundedHeap.h"
 
-VectorMethod::VectorMethod(unsigned int dimensions, long double norm, unsigned int k, unsigned int w) : Method(dimensions, norm, k, w) {}
+VectorMethod::VectorMethod(unsigned int dimensions, double norm, unsigned int k, unsigned int w) : Method(dimensions, norm, k, w) {}
+
+VectorMethod::VectorMethod(IndexReader &indexReader) : Method(indexReader) {}
 
 VectorMethod::~VectorMethod() {}
 
+/* Utility function to write the given Points as their positions in the given dataset, which should contain every one of them */
+void VectorMethod::savePoints(IndexWriter &indexWriter, const std::vector<Point *> &points, const std::vector<Point *> &dataset) {
+
+    std::unordered_map<const Point *, uint32_t> positions;
+    for (unsigned int i = 0; i < dataset.size(); ++i)
+        positions[dataset[i]] = i;
+
+    std::vector<uint32_t> indices;
+    for (Point *point: points)
+        indices.push_back(positions.at(point));
+
+    indexWriter.writeArray(indices);
+}
+
+/* Utility function to read the Points written by VectorMethod::savePoints from the given dataset and append them to points */
+void VectorMethod::loadPoints(IndexReader &indexReader, const std::vector<Point *> &dataset, std::vector<Point *> &points) {
+
+    std::vector<uint32_t> indices;
+    indexReader.readArray(indices);
+
+    for (uint32_t index: indices) {
+
+        if (index >= dataset.size()) {
+            indexReader.invalidate();
+            return;
+        }
+
+        points.push_back(dataset[index]);
+    }
+}
+
+/* Function to insert the given Points using at most the given number of threads
+ * Derived classes may override it to insert the Points in bulk more efficiently, otherwise the Points are inserted one by one */
+void VectorMethod::build(const std::vector<Point *> &points, unsigned int) {
+
+    for (Point *point: points)
+        this->insertPoint(point);
+}
+
 /* Utility function to get the exact neighbor of a Point given a set of Points and a Vector metric */
-std::tuple<Point *, long double, double> VectorMethod::getExactNeighbor(Point *const queryPoint, const std::vector<Point *> &inputPoints, VectorMetric *vectorMetric) {
+std::tuple<Point *, distance_t, double> VectorMethod::getExactNeighbor(Point *const queryPoint, const std::vector<Point *> &inputPoints, VectorMetric *vectorMetric) const {
 
-    long double minDistance = std::numeric_limits<long double>::max();
+    distance_t minDistance = std::numeric_limits<distance_t>::max();
     Point *nearestNeighbor = nullptr;
 
     /* Start the clock */
     std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
 
-    for (Point *point: inputPoints) {
-
-        long double distanceToQueryPoint = vectorMetric->distance(*queryPoint, *point);
+    /* Calculate the distances of all the Points at once and then find the minimum one */
+    std::vector<distance_t> distances;
+    vectorMetric->distances(*queryPoint, inputPoints, distances);
 
-        if (distanceToQueryPoint < minDistance) {
-            minDistance = distanceToQueryPoint;
-            nearestNeighbor = point;
+    for (unsigned int i = 0; i < inputPoints.size(); ++i)
+        if (distances[i] < minDistance) {
+            minDistance = distances[i];
+            nearestNeighbor = inputPoints[i];
             if (minDistance == 0.0)
                 break;
         }
-    }
 
     /* Stop the clock */
     std::chrono::high_resolution_clock::time_point finish = std::chrono::high_resolution_clock::now();
@@ -35,4 +78,19 @@ std::tuple<Point *, long double, double> VectorMethod::getExactNeighbor(Point *c
     return std::make_tuple(nearestNeighbor, minDistance, std::chrono::duration<double, std::milli>(duration).count());
 }
 
+/* Utility function to get the exact k nearest neighbors of a Point given a set of Points and a Vector metric, sorted in ascending order of their distances */
+std::vector<std::pair<Point *, distance_t>> *VectorMethod::getExactKNearestNeighbors(Point *const queryPoint, unsigned int k, const std::vector<Point *> &inputPoints, VectorMetric *vectorMetric) const {
+
+    BoundedHeap<Point *> nearestNeighbors(k);
+
+    /* Calculate the distances of all the Points at once and keep the k smallest ones */
+    std::vector<distance_t> distances;
+    vectorMetric->distances(*queryPoint, inputPoints, distances);
+
+    for (unsigned int i = 0; i < inputPoints.size(); ++i)
+        nearestNeighbors.push(inputPoints[i], distances[i]);
+
+    return nearestNeighbors.toSortedVector();
+}
+
 
@@ -5,19 +5,31 @@
 #include "../Method/Method.h"
 #include <tuple>
 
-/* Abstract base class for VectorLSH and Hypercube */
+/* Abstract base class for VectorLSH and Hypercube
+ * The query functions are const as a built data structure may be queried by several threads at once */
 
 class VectorMethod : public Method {
 
+protected:
+    VectorMethod(IndexReader &);
+    static void savePoints(IndexWriter &, const std::vector<Point *> &, const std::vector<Point *> &);
+    static void loadPoints(IndexReader &, const std::vector<Point *> &, std::vector<Point *> &);
+
 public:
-    VectorMethod(unsigned int, long double, unsigned int, unsigned int);
+    VectorMethod(unsigned int, double, unsigned int, unsigned int);
     virtual ~VectorMethod();
+    /* Pure virtual function as each derived class stores a different data structure. The inserted Points are stored by their position in the given dataset */
+    virtual void save(IndexWriter &, const std::vector<Point *> &) const = 0;
     /* Pure virtual function as each derived class may insert a Point in a different way */
     virtual void insertPoint(Point *const) = 0;
+    virtual void build(const std::vector<Point *> &, unsigned int);
     /* Pure virtual function as each derived class may perform range search in a different way */
-    virtual std::vector<Point *> *rangeSearch(Point *const, long double, VectorMetric *) = 0;
-    virtual std::tuple<Point *, long double, double> getApproximateNearestNeighbor(Point *const, VectorMetric *) = 0;
-    virtual std::tuple<Point *, long double, double> getExactNeighbor(Point *const, const std::vector<Point *> &, VectorMetric *);
+    virtual std::vector<Point *> *rangeSearch(Point *const, distance_t, VectorMetric *) const = 0;
+    virtual std::tuple<Point *, distance_t, double> getApproximateNearestNeighbor(Point *const, VectorMetric *) const = 0;
+    virtual std::tuple<Point *, distance_t, double> getExactNeighbor(Point *const, const std::vector<Point *> &, VectorMetric *) const;
+    /* Pure virtual function as each derived class may collect the candidate neighbors in a different way */
+    virtual std::vector<std::pair<Point *, distance_t>> *getKNearestNeighbors(Point *const, unsigned int, VectorMetric *) const = 0;
+    virtual std::vector<std::pair<Point *, distance_t>> *getExactKNearestNeighbors(Point *const, unsigned int, const std::vector<Point *> &, VectorMetric *) const;
 };
 
 
@@ -1,17 +1,91 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "ContinuousFrechet.h"
 #include "include/Frechet.hpp"
+#include "../../Utilities/Parallel/Parallel.h"
 
 ContinuousFrechet::ContinuousFrechet() {}
 
 ContinuousFrechet::~ContinuousFrechet() {}
 
-/* Utility function to calculate the Continuous Frechet distance between 2 Curves according to the library that we were provided with */
-long double ContinuousFrechet::distance(const Curve &curveOne, const Curve &curveTwo) const {
+/* Utility function to calculate the Continuous Frechet distance between 2 Curves according to the library that we were provided with
+ * The library is asked for a serial calculation within a Parallel::parallelFor, whose threads already use every hardware thread e.g. by answering Queries in parallel */
+distance_t ContinuousFrechet::distance(const Curve &curveOne, const Curve &curveTwo) const {
 
     if (curveOne.getComplexity() < 2 || curveTwo.getComplexity() < 2)
         return CurveMetric::INVALID_PARAMETERS;
 
-    return (long double) Frechet::Continuous::distance(curveOne, curveTwo).value;
+    return Frechet::Continuous::distance(curveOne, curveTwo, Parallel::isInsideParallelFor()).value;
+}
+
+/* Utility function to widen a threshold by the relative error that the binary search of the library approximates the Continuous Frechet distance within
+ * The distance of the library never exceeds the exact one, which in turn never exceeds the widened distance of the library */
+static distance_t widenThreshold(distance_t threshold) {
+    return threshold + std::max(threshold * Frechet::Continuous::error / 100, std::numeric_limits<distance_t>::epsilon());
+}
+
+/* Utility function to calculate the Continuous Frechet distance between 2 Curves, which is only calculated in case none of the following lower bounds exceeds the threshold :
+ * 1) The O(1) lower bounds of CurveMetric, which bound the exact distance rather than the one of the library and are thus compared with the threshold widened by the error of the library
+ * 2) The O(nm) projective lower bound of the library, which the binary search of the library starts from anyway and is much cheaper than the search itself
+ * 3) The widened threshold itself, in case a single decision of the library finds that the distance exceeds it, which replaces the dozens of decisions of the binary search
+ * Otherwise every decision of the binary search beyond the widened threshold would be positive as well, thus they are skipped and its result is identical to ContinuousFrechet::distance */
+distance_t ContinuousFrechet::boundedDistance(const Curve &curveOne, const Curve &curveTwo, distance_t threshold) const {
+
+    if (curveOne.getComplexity() < 2 || curveTwo.getComplexity() < 2 || curveOne.getDimensions() != curveTwo.getDimensions())
+        return CurveMetric::INVALID_PARAMETERS;
+
+    bool serial = Parallel::isInsideParallelFor();
+    distance_t widenedThreshold = widenThreshold(threshold);
+
+    distance_t lowerBound = CurveMetric::endpointsLowerBound(curveOne, curveTwo);
+    if (lowerBound > widenedThreshold)
+        return lowerBound;
+
+    lowerBound = CurveMetric::boundingBoxLowerBound(curveOne, curveTwo);
+    if (lowerBound > widenedThreshold)
+        return lowerBound;
+
+    lowerBound = Frechet::Continuous::_projective_lower_bound(curveOne, curveTwo, serial);
+    if (lowerBound > threshold)
+        return lowerBound;
+
+    distance_t upperBound = Frechet::Continuous::_greedy_upper_bound(curveOne, curveTwo);
+    if (upperBound > widenedThreshold && !Frechet::Continuous::less_than_or_equal(widenedThreshold, curveOne, curveTwo, serial))
+        return std::nextafter(widenedThreshold, std::numeric_limits<distance_t>::max());
+
+    return Frechet::Continuous::_distance(curveOne, curveTwo, upperBound, lowerBound, std::min(upperBound, widenedThreshold), serial).value;
+}
+
+/* Utility function to decide whether the Continuous Frechet distance between 2 Curves does not exceed the given threshold, consistently with ContinuousFrechet::distance
+ * The lower bounds of ContinuousFrechet::boundedDistance and the greedy upper bound of the library decide most pairs, otherwise a single decision of the library is made at the widened and at the given threshold
+ * Only in case the former is positive and the latter negative is the distance of the library calculated, as it may fall on either side of the given threshold */
+bool ContinuousFrechet::isWithin(const Curve &curveOne, const Curve &curveTwo, distance_t threshold) const {
+
+    if (curveOne.getComplexity() < 2 || curveTwo.getComplexity() < 2 || curveOne.getDimensions() != curveTwo.getDimensions())
+        return false;
+
+    bool serial = Parallel::isInsideParallelFor();
+    distance_t widenedThreshold = widenThreshold(threshold);
+
+    if (CurveMetric::endpointsLowerBound(curveOne, curveTwo) > widenedThreshold || CurveMetric::boundingBoxLowerBound(curveOne, curveTwo) > widenedThreshold)
+        return false;
+
+    distance_t lowerBound = Frechet::Continuous::_projective_lower_bound(curveOne, curveTwo, serial);
+    if (lowerBound > threshold)
+        return false;
+
+    distance_t upperBound = Frechet::Continuous::_greedy_upper_bound(curveOne, curveTwo);
+    if (upperBound <= threshold)
+        return true;
+
+    if (upperBound > widenedThreshold && !Frechet::Continuous::less_than_or_equal(widenedThreshold, curveOne, curveTwo, serial))
+        return false;
+
+    if (Frechet::Continuous::less_than_or_equal(threshold, curveOne, curveTwo, serial))
+        return true;
+
+    return Frechet::Continuous::_distance(curveOne, curveTwo, upperBound, lowerBound, std::min(upperBound, widenedThreshold), serial).value <= threshold;
 }
 
 
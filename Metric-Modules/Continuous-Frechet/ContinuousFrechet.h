@@ -10,7 +10,9 @@ class ContinuousFrechet : public CurveMetric {
 public:
     ContinuousFrechet();
     virtual ~ContinuousFrechet();
-    long double distance(const Curve &, const Curve &) const;
+    distance_t distance(const Curve &, const Curve &) const;
+    distance_t boundedDistance(const Curve &, const Curve &, distance_t) const;
+    bool isWithin(const Curve &, const Curve &, distance_t) const;
 };
 
 
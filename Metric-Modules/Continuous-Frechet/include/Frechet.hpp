@@ -10,6 +10,36 @@ namespace Frechet {
 
         extern distance_t error;
 
+        /* Free space diagram of 2 Curves of n1 and n2 Points, whose reachable parameters and free intervals are kept in 2 flat arrays
+         * Each thread reuses a single FreeSpace, which is only grown in case of longer Curves, thus no allocations take place per distance */
+        class FreeSpace {
+            curve_size_t n1 = 0, n2 = 0;
+            Parameters parameters;
+            Intervals intervals;
+
+        public:
+            static FreeSpace &get(curve_size_t, curve_size_t);
+            void resize(curve_size_t, curve_size_t);
+
+            /* reachable1(i, j) for i < n1 - 1, j < n2 and reachable2(i, j) for i < n1, j < n2 - 1 */
+            inline parameter_t &reachable1(curve_size_t i, curve_size_t j) {
+                return parameters[i * n2 + j];
+            }
+
+            inline parameter_t &reachable2(curve_size_t i, curve_size_t j) {
+                return parameters[(n1 - 1) * n2 + i * (n2 - 1) + j];
+            }
+
+            /* free_intervals1(j, i) for j < n2, i < n1 and free_intervals2(i, j) for i < n1, j < n2 */
+            inline Interval &free_intervals1(curve_size_t j, curve_size_t i) {
+                return intervals[j * n1 + i];
+            }
+
+            inline Interval &free_intervals2(curve_size_t i, curve_size_t j) {
+                return intervals[n2 * n1 + i * n2 + j];
+            }
+        };
+
         struct Distance {
             distance_t value;
             double time_searches;
@@ -18,10 +48,16 @@ namespace Frechet {
             std::string repr() const;
         };
 
-        Distance distance(const Curve &, const Curve &);
-        Distance _distance(const Curve &, const Curve &, distance_t, distance_t);
-        bool _less_than_or_equal(const distance_t, const Curve &, const Curve &, std::vector<Parameters> &, std::vector<Parameters> &, std::vector<Intervals> &, std::vector<Intervals> &);
+        // serial asks for a single thread regardless of OpenMP e.g. in case the caller already runs one distance per hardware thread
+        Distance distance(const Curve &, const Curve &, const bool = false);
+        Distance _distance(const Curve &, const Curve &, distance_t, distance_t, distance_t = std::numeric_limits<distance_t>::infinity(), const bool = false);
+        bool less_than_or_equal(const distance_t, const Curve &, const Curve &, const bool = false);
+        bool _less_than_or_equal(const distance_t, const Curve &, const Curve &, FreeSpace &, const bool = false);
+        void _initialize_free_space(const distance_t, const Curve &, const Curve &, FreeSpace &, const bool);
+        bool _parallel(const curve_size_t, const bool);
+        void _propagate_block(const curve_size_t, const curve_size_t, FreeSpace &, const curve_size_t, const curve_size_t, const curve_size_t, const curve_size_t);
+        void _propagate_reachability(const curve_size_t, const curve_size_t, FreeSpace &, const bool);
         distance_t _greedy_upper_bound(const Curve &, const Curve &);
-        distance_t _projective_lower_bound(const Curve &, const Curve &);
+        distance_t _projective_lower_bound(const Curve &, const Curve &, const bool = false);
     }
 }
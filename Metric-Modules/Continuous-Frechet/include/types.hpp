@@ -4,9 +4,14 @@
 #include <cmath>
 #include <limits>
 
-typedef double distance_t;
-typedef double coordinate_t;
-typedef long double parameter_t;
+/* The coordinate type is selected at build time e.g. make PRECISION=float and defaults to double */
+#ifndef COORDINATE_TYPE
+#define COORDINATE_TYPE double
+#endif
+
+typedef COORDINATE_TYPE coordinate_t;
+typedef coordinate_t distance_t;
+typedef coordinate_t parameter_t;
 
 typedef unsigned long dimensions_t;
 typedef unsigned long curve_size_t;
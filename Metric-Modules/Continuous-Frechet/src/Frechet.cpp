@@ -5,6 +5,10 @@
 #include <sstream>
 #include "../include/Frechet.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace Frechet {
 
     namespace Continuous {
@@ -12,13 +16,43 @@ namespace Frechet {
         distance_t error = 1;
         bool round = true;
 
+        // below this number of free space cells the OpenMP threads cost more than they save
+        const curve_size_t PARALLEL_MINIMUM_CELLS = 1 << 16;
+        // the side of the square tiles of the wavefront, which are propagated serially by a single thread
+        const curve_size_t WAVEFRONT_TILE_SIZE = 64;
+
+        // OpenMP is only used in case it is enabled (make OPENMP=1), the free space is large enough, the caller is not inside an OpenMP region and it does not ask for a serial computation
+        // e.g. as it already uses every hardware thread by answering Queries in parallel
+        bool _parallel(const curve_size_t cells, const bool serial) {
+#ifdef _OPENMP
+            return not serial and cells >= PARALLEL_MINIMUM_CELLS and omp_get_max_threads() > 1 and not omp_in_parallel();
+#else
+            (void) cells;
+            (void) serial;
+            return false;
+#endif
+        }
+
+        FreeSpace &FreeSpace::get(curve_size_t n1, curve_size_t n2) {
+            thread_local FreeSpace free_space;
+            free_space.resize(n1, n2);
+            return free_space;
+        }
+
+        void FreeSpace::resize(curve_size_t n1, curve_size_t n2) {
+            this->n1 = n1;
+            this->n2 = n2;
+            if (parameters.size() < (n1 - 1) * n2 + n1 * (n2 - 1)) parameters.resize((n1 - 1) * n2 + n1 * (n2 - 1));
+            if (intervals.size() < 2 * n1 * n2) intervals.resize(2 * n1 * n2);
+        }
+
         std::string Distance::repr() const {
             std::stringstream ss;
             ss << value;
             return ss.str();
         }
 
-        Distance distance(const Curve &curve1, const Curve &curve2) {
+        Distance distance(const Curve &curve1, const Curve &curve2, const bool serial) {
             if ((curve1.getComplexity() < 2) or (curve2.getComplexity() < 2)) {
                 std::cerr << "WARNING: comparison possible only for curves of at least two points" << std::endl;
                 Distance result;
@@ -33,17 +67,19 @@ namespace Frechet {
             }
 
             const auto start = std::clock();
-            const distance_t lb = _projective_lower_bound(curve1, curve2);
+            const distance_t lb = _projective_lower_bound(curve1, curve2, serial);
             const distance_t ub = _greedy_upper_bound(curve1, curve2);
             const auto end = std::clock();
 
-            auto dist = _distance(curve1, curve2, ub, lb);
+            auto dist = _distance(curve1, curve2, ub, lb, std::numeric_limits<distance_t>::infinity(), serial);
             dist.time_bounds = (end - start) / CLOCKS_PER_SEC;
 
             return dist;
         }
 
-        Distance _distance(const Curve &curve1, const Curve &curve2, distance_t ub, distance_t lb) {
+        // known_ub is a distance that has already been decided positively e.g. a threshold, thus every split beyond it is decided positively without evaluating the free space
+        // the free space only grows with the distance, so the decisions it skips are positive anyway and the result is identical to the one of the search without it
+        Distance _distance(const Curve &curve1, const Curve &curve2, distance_t ub, distance_t lb, distance_t known_ub, const bool serial) {
             Distance result;
             const auto start = std::clock();
 
@@ -53,12 +89,7 @@ namespace Frechet {
 
             if (ub - lb > p_error) {
 
-                const auto infty = std::numeric_limits<parameter_t>::infinity();
-                std::vector<Parameters> reachable1(curve1.getComplexity() - 1, Parameters(curve2.getComplexity(), infty));
-                std::vector<Parameters> reachable2(curve1.getComplexity(), Parameters(curve2.getComplexity() - 1, infty));
-
-                std::vector<Intervals> free_intervals1(curve2.getComplexity(), Intervals(curve1.getComplexity(), Interval()));
-                std::vector<Intervals> free_intervals2(curve1.getComplexity(), Intervals(curve2.getComplexity(), Interval()));
+                FreeSpace &free_space = FreeSpace::get(curve1.getComplexity(), curve2.getComplexity());
 
                 if (std::isnan(lb) or std::isnan(ub)) {
                     result.value = std::numeric_limits<distance_t>::signaling_NaN();
@@ -70,7 +101,7 @@ namespace Frechet {
                     ++number_searches;
                     split = (ub + lb) / distance_t(2);
                     if (split == lb or split == ub) break;
-                    auto isLessThan = _less_than_or_equal(split, curve1, curve2, reachable1, reachable2, free_intervals1, free_intervals2);
+                    auto isLessThan = split > known_ub or _less_than_or_equal(split, curve1, curve2, free_space, serial);
                     if (isLessThan) {
                         ub = split;
                     }
@@ -87,70 +118,114 @@ namespace Frechet {
             return result;
         }
 
-        bool _less_than_or_equal(const distance_t distance, Curve const &curve1, Curve const &curve2, std::vector<Parameters> &reachable1, std::vector<Parameters> &reachable2, std::vector<Intervals> &free_intervals1, std::vector<Intervals> &free_intervals2) {
+        bool less_than_or_equal(const distance_t distance, const Curve &curve1, const Curve &curve2, const bool serial) {
+            return _less_than_or_equal(distance, curve1, curve2, FreeSpace::get(curve1.getComplexity(), curve2.getComplexity()), serial);
+        }
+
+        bool _less_than_or_equal(const distance_t distance, Curve const &curve1, Curve const &curve2, FreeSpace &free_space, const bool serial) {
+            const curve_size_t n1 = curve1.getComplexity();
+            const curve_size_t n2 = curve2.getComplexity();
+            const bool parallel = _parallel(n1 * n2, serial);
+
+            _initialize_free_space(distance, curve1, curve2, free_space, parallel);
+            _propagate_reachability(n1, n2, free_space, parallel);
+
+            return free_space.reachable1(n1 - 2, n2 - 1) < std::numeric_limits<parameter_t>::infinity();
+        }
+
+        // the free intervals of every cell and the reachable parameters of the first row and column, the rest of which are unreachable until propagated
+        void _initialize_free_space(const distance_t distance, Curve const &curve1, Curve const &curve2, FreeSpace &free_space, const bool parallel) {
+            (void) parallel; // only read by the OpenMP pragmas
 
             const distance_t dist_sqr = distance * distance;
             const auto infty = std::numeric_limits<parameter_t>::infinity();
             const curve_size_t n1 = curve1.getComplexity();
             const curve_size_t n2 = curve2.getComplexity();
 
-#pragma omp parallel for collapse(2) if (n1 * n2 > 1000)
+#pragma omp parallel for collapse(2) if (parallel)
             for (curve_size_t i = 0; i < n1; ++i) {
                 for (curve_size_t j = 0; j < n2; ++j) {
-                    if (i < n1 - 1) reachable1[i][j] = infty;
-                    if (j < n2 - 1) reachable2[i][j] = infty;
-                    free_intervals1[j][i].reset();
-                    free_intervals2[i][j].reset();
+                    if (i < n1 - 1) free_space.reachable1(i, j) = infty;
+                    if (j < n2 - 1) free_space.reachable2(i, j) = infty;
+                    free_space.free_intervals1(j, i).reset();
+                    free_space.free_intervals2(i, j).reset();
                 }
             }
 
             for (curve_size_t i = 0; i < n1 - 1; ++i) {
-                reachable1[i][0] = 0;
+                free_space.reachable1(i, 0) = 0;
                 if (curve2[0].dist_sqr(curve1[i + 1]) > dist_sqr) break;
             }
 
             for (curve_size_t j = 0; j < n2 - 1; ++j) {
-                reachable2[0][j] = 0;
+                free_space.reachable2(0, j) = 0;
                 if (curve1[0].dist_sqr(curve2[j + 1]) > dist_sqr) break;
             }
 
-#pragma omp parallel for collapse(2) if (n1 * n2 > 1000)
+#pragma omp parallel for collapse(2) if (parallel)
             for (curve_size_t i = 0; i < n1; ++i) {
                 for (curve_size_t j = 0; j < n2; ++j) {
                     if ((i < n1 - 1) and (j > 0)) {
-                        free_intervals1[j][i] = curve2[j].ball_intersection_interval(dist_sqr, curve1[i], curve1[i + 1]);
+                        free_space.free_intervals1(j, i) = curve2[j].ball_intersection_interval(dist_sqr, curve1[i], curve1[i + 1]);
                     }
                     if ((j < n2 - 1) and (i > 0)) {
-                        free_intervals2[i][j] = curve1[i].ball_intersection_interval(dist_sqr, curve2[j], curve2[j + 1]);
+                        free_space.free_intervals2(i, j) = curve1[i].ball_intersection_interval(dist_sqr, curve2[j], curve2[j + 1]);
                     }
                 }
             }
+        }
 
-            for (curve_size_t i = 0; i < n1; ++i) {
-                for (curve_size_t j = 0; j < n2; ++j) {
+        // the reachable parameters of the cells [i_begin, i_end) x [j_begin, j_end) in row-major order, given those of the cells above and to the left of the block
+        void _propagate_block(const curve_size_t n1, const curve_size_t n2, FreeSpace &free_space, const curve_size_t i_begin, const curve_size_t i_end, const curve_size_t j_begin, const curve_size_t j_end) {
+            const auto infty = std::numeric_limits<parameter_t>::infinity();
+
+            for (curve_size_t i = i_begin; i < i_end; ++i) {
+                for (curve_size_t j = j_begin; j < j_end; ++j) {
                     if ((i < n1 - 1) and (j > 0)) {
-                        if (not free_intervals1[j][i].empty()) {
-                            if (reachable2[i][j - 1] != infty) {
-                                reachable1[i][j] = free_intervals1[j][i].begin();
+                        if (not free_space.free_intervals1(j, i).empty()) {
+                            if (free_space.reachable2(i, j - 1) != infty) {
+                                free_space.reachable1(i, j) = free_space.free_intervals1(j, i).begin();
                             }
-                            else if (reachable1[i][j - 1] <= free_intervals1[j][i].end()) {
-                                reachable1[i][j] = std::max(free_intervals1[j][i].begin(), reachable1[i][j - 1]);
+                            else if (free_space.reachable1(i, j - 1) <= free_space.free_intervals1(j, i).end()) {
+                                free_space.reachable1(i, j) = std::max(free_space.free_intervals1(j, i).begin(), free_space.reachable1(i, j - 1));
                             }
                         }
                     }
                     if ((j < n2 - 1) and (i > 0)) {
-                        if (not free_intervals2[i][j].empty()) {
-                            if (reachable1[i - 1][j] != infty) {
-                                reachable2[i][j] = free_intervals2[i][j].begin();
+                        if (not free_space.free_intervals2(i, j).empty()) {
+                            if (free_space.reachable1(i - 1, j) != infty) {
+                                free_space.reachable2(i, j) = free_space.free_intervals2(i, j).begin();
                             }
-                            else if (reachable2[i - 1][j] <= free_intervals2[i][j].end()) {
-                                reachable2[i][j] = std::max(free_intervals2[i][j].begin(), reachable2[i - 1][j]);
+                            else if (free_space.reachable2(i - 1, j) <= free_space.free_intervals2(i, j).end()) {
+                                free_space.reachable2(i, j) = std::max(free_space.free_intervals2(i, j).begin(), free_space.reachable2(i - 1, j));
                             }
                         }
                     }
                 }
             }
-            return reachable1.back().back() < infty;
+        }
+
+        // each cell only depends on the cells above and to the left of it, thus the tiles of each anti-diagonal are independent and the anti-diagonals are processed in order (wavefront)
+        // the results are identical to a single row-major pass
+        void _propagate_reachability(const curve_size_t n1, const curve_size_t n2, FreeSpace &free_space, const bool parallel) {
+            if (not parallel) {
+                _propagate_block(n1, n2, free_space, 0, n1, 0, n2);
+                return;
+            }
+
+            const curve_size_t tiles1 = (n1 + WAVEFRONT_TILE_SIZE - 1) / WAVEFRONT_TILE_SIZE, tiles2 = (n2 + WAVEFRONT_TILE_SIZE - 1) / WAVEFRONT_TILE_SIZE;
+
+#pragma omp parallel
+            for (curve_size_t diagonal = 0; diagonal < tiles1 + tiles2 - 1; ++diagonal) {
+                const curve_size_t first = diagonal < tiles2 ? 0 : diagonal - tiles2 + 1, last = std::min(diagonal, tiles1 - 1);
+
+                // the implicit barrier of the loop separates the anti-diagonals
+#pragma omp for schedule(dynamic)
+                for (curve_size_t tile1 = first; tile1 <= last; ++tile1) {
+                    const curve_size_t tile2 = diagonal - tile1;
+                    _propagate_block(n1, n2, free_space, tile1 * WAVEFRONT_TILE_SIZE, std::min(n1, (tile1 + 1) * WAVEFRONT_TILE_SIZE), tile2 * WAVEFRONT_TILE_SIZE, std::min(n2, (tile2 + 1) * WAVEFRONT_TILE_SIZE));
+                }
+            }
         }
 
         distance_t _greedy_upper_bound(const Curve &curve1, const Curve &curve2) {
@@ -181,40 +256,48 @@ namespace Frechet {
             return std::sqrt(result);
         }
 
-        distance_t _projective_lower_bound(const Curve &curve1, const Curve &curve2) {
-            std::vector<distance_t> distances1_sqr = std::vector<distance_t>(curve2.getComplexity() - 1), distances2_sqr = std::vector<distance_t>(curve1.getComplexity() + curve2.getComplexity() + 2);
+        distance_t _projective_lower_bound(const Curve &curve1, const Curve &curve2, const bool serial) {
+            const curve_size_t n1 = curve1.getComplexity(), n2 = curve2.getComplexity();
+            const bool parallel = _parallel(n1 * n2, serial);
+            (void) parallel; // only read by the OpenMP pragmas
+
+            // each thread reuses its own buffer; the parallel loops use a reference to it, as a thread_local named inside an OpenMP region denotes the instance of each OpenMP thread
+            thread_local Distances distances_buffer;
+            Distances &distances_sqr = distances_buffer;
+            distances_sqr.resize(n1 + n2 + 2);
 
-            for (curve_size_t i = 0; i < curve1.getComplexity(); ++i) {
-#pragma omp parallel for
-                for (curve_size_t j = 0; j < curve2.getComplexity() - 1; ++j) {
+            // the rows are independent, thus a single team of threads shares them instead of a team being spawned per row
+#pragma omp parallel for if (parallel)
+            for (curve_size_t i = 0; i < n1; ++i) {
+                distance_t minimum = std::numeric_limits<distance_t>::infinity();
+                for (curve_size_t j = 0; j < n2 - 1; ++j) {
                     if (curve2[j].dist_sqr(curve2[j + 1]) > 0) {
-                        distances1_sqr[j] = curve1[i].line_segment_dist_sqr(curve2[j], curve2[j + 1]);
+                        minimum = std::min(minimum, curve1[i].line_segment_dist_sqr(curve2[j], curve2[j + 1]));
                     }
                     else {
-                        distances1_sqr[j] = curve1[i].dist_sqr(curve2[j]);
+                        minimum = std::min(minimum, curve1[i].dist_sqr(curve2[j]));
                     }
                 }
-                distances2_sqr[i] = *std::min_element(distances1_sqr.begin(), distances1_sqr.end());
+                distances_sqr[i] = minimum;
             }
 
-            distances1_sqr = std::vector<distance_t>(curve1.getComplexity() - 1);
-
-            for (curve_size_t i = 0; i < curve2.getComplexity(); ++i) {
-#pragma omp parallel for
-                for (curve_size_t j = 0; j < curve1.getComplexity() - 1; ++j) {
+#pragma omp parallel for if (parallel)
+            for (curve_size_t i = 0; i < n2; ++i) {
+                distance_t minimum = std::numeric_limits<distance_t>::infinity();
+                for (curve_size_t j = 0; j < n1 - 1; ++j) {
                     if (curve1[j].dist_sqr(curve1[j + 1]) > 0) {
-                        distances1_sqr[j] = curve2[i].line_segment_dist_sqr(curve1[j], curve1[j + 1]);
+                        minimum = std::min(minimum, curve2[i].line_segment_dist_sqr(curve1[j], curve1[j + 1]));
                     }
                     else {
-                        distances1_sqr[j] = curve2[i].dist_sqr(curve1[j]);
+                        minimum = std::min(minimum, curve2[i].dist_sqr(curve1[j]));
                     }
                 }
-                distances2_sqr[curve1.getComplexity() + i] = *std::min_element(distances1_sqr.begin(), distances1_sqr.end());
+                distances_sqr[n1 + i] = minimum;
             }
 
-            distances2_sqr[curve1.getComplexity() + curve2.getComplexity()] = curve1[0].dist_sqr(curve2[0]);
-            distances2_sqr[curve1.getComplexity() + curve2.getComplexity() + 1] = curve1[curve1.getComplexity() - 1].dist_sqr(curve2[curve2.getComplexity() - 1]);
-            return std::sqrt(*std::max_element(distances2_sqr.begin(), distances2_sqr.end()));
+            distances_sqr[n1 + n2] = curve1[0].dist_sqr(curve2[0]);
+            distances_sqr[n1 + n2 + 1] = curve1[n1 - 1].dist_sqr(curve2[n2 - 1]);
+            return std::sqrt(*std::max_element(distances_sqr.begin(), distances_sqr.end()));
         }
 
     }
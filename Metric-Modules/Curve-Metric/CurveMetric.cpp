@@ -1,5 +1,43 @@
+#include <algorithm>
+#include <cmath>
 #include "CurveMetric.h"
 
-const long double CurveMetric::INVALID_PARAMETERS = std::numeric_limits<long double>::max();
+const distance_t CurveMetric::INVALID_PARAMETERS = std::numeric_limits<distance_t>::max();
 
 CurveMetric::~CurveMetric() {}
+
+/* The base class calculates the exact distance regardless of the threshold */
+distance_t CurveMetric::boundedDistance(const Curve &curveOne, const Curve &curveTwo, distance_t) const {
+    return this->distance(curveOne, curveTwo);
+}
+
+/* The base class compares the bounded distance with the threshold, which is abandoned early by the derived classes that support it e.g. DiscreteFrechet */
+bool CurveMetric::isWithin(const Curve &curveOne, const Curve &curveTwo, distance_t threshold) const {
+    return this->boundedDistance(curveOne, curveTwo, threshold) <= threshold;
+}
+
+/* Utility function to calculate the longest of the distances between the first Points and between the last Points of 2 non-empty Curves of the same dimensions
+ * Every traversal of 2 Curves starts at their first Points and ends at their last Points
+ * The distances are calculated exactly like the projective lower bound of the Continuous Frechet Distance library calculates them, which includes them */
+distance_t CurveMetric::endpointsLowerBound(const Curve &curveOne, const Curve &curveTwo) {
+
+    distance_t firstSquaredDistance = curveOne[0].dist_sqr(curveTwo[0]);
+    distance_t lastSquaredDistance = curveOne[curveOne.getComplexity() - 1].dist_sqr(curveTwo[curveTwo.getComplexity() - 1]);
+
+    return std::sqrt(std::max(firstSquaredDistance, lastSquaredDistance));
+}
+
+/* Utility function to calculate the longest of the differences between the minimum and between the maximum coordinates of 2 non-empty Curves of the same dimensions in any dimension
+ * The Point of a Curve with the minimum coordinate is matched to a Point of the other Curve, whose coordinate is greater than or equal to the other Curve's minimum, and likewise for the maximum
+ * The difference is squared and then rooted in order to be rounded exactly like the distances it bounds */
+distance_t CurveMetric::boundingBoxLowerBound(const Curve &curveOne, const Curve &curveTwo) {
+
+    distance_t longestDifference = 0.0;
+
+    for (unsigned int i = 0; i < curveOne.getDimensions(); ++i) {
+        longestDifference = std::max(longestDifference, (distance_t) std::abs(curveOne.getMinimumCoordinates()[i] - curveTwo.getMinimumCoordinates()[i]));
+        longestDifference = std::max(longestDifference, (distance_t) std::abs(curveOne.getMaximumCoordinates()[i] - curveTwo.getMaximumCoordinates()[i]));
+    }
+
+    return std::sqrt(longestDifference * longestDifference);
+}
@@ -8,10 +8,19 @@
 class CurveMetric {
 
 public:
-    const static long double INVALID_PARAMETERS;
+    const static distance_t INVALID_PARAMETERS;
     virtual ~CurveMetric();
     /* Pure virtual function as each derived class may calculate distance between two Curves in a different way */
-    virtual long double distance(const Curve &, const Curve &) const = 0;
+    virtual distance_t distance(const Curve &, const Curve &) const = 0;
+    /* Same as above, where the caller is only interested in distances that do not exceed the given threshold
+     * Derived classes may override it to abandon the calculation early and return a lower bound of the distance that exceeds the threshold */
+    virtual distance_t boundedDistance(const Curve &, const Curve &, distance_t) const;
+    /* Function to decide whether the distance between 2 Curves does not exceed the given threshold, which is all that a range search needs to know
+     * Derived classes may override it to decide without calculating the distance */
+    virtual bool isWithin(const Curve &, const Curve &, distance_t) const;
+    /* Lower bounds of both the Discrete and the Continuous Frechet distance, which only take O(1) time */
+    static distance_t endpointsLowerBound(const Curve &, const Curve &);
+    static distance_t boundingBoxLowerBound(const Curve &, const Curve &);
 };
 
 
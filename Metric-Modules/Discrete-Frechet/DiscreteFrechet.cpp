@@ -1,46 +1,85 @@
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include "DiscreteFrechet.h"
 #include "../Vector-Metric/VectorMetric.h"
+#include "../Distance-Kernels/DistanceKernels.h"
 
 DiscreteFrechet::DiscreteFrechet() {}
 
 DiscreteFrechet::~DiscreteFrechet() {}
 
 /* Utility function to calculate the Discrete Frechet distance between 2 Curves according to the slides that we were provided with */
-long double DiscreteFrechet::distance(const Curve &curveOne, const Curve &curveTwo) const {
+distance_t DiscreteFrechet::distance(const Curve &curveOne, const Curve &curveTwo) const {
+    return this->boundedDistance(curveOne, curveTwo, std::numeric_limits<distance_t>::max());
+}
 
-    if (curveOne.getComplexity() == 0 || curveTwo.getComplexity() == 0)
+/* Utility function to calculate the Discrete Frechet distance between 2 Curves, which is abandoned as soon as it is certain to exceed the given threshold
+ * The distances of the first and of the last Points and the bounding box lower bound of CurveMetric are checked first, so that a Curve far from the other one is rejected without filling any row of the matrix
+ * The former are calculated like the cells of the matrix, in order to bound the distance exactly
+ * The cells use the DistanceKernels of VectorMetric::distance, since an inline sum of squares may round differently from the selected kernel e.g. in case the latter contracts it into FMA instructions
+ * Only the previous and the current row of the dynamic programming matrix are kept in a buffer that is reused by each thread and the cells hold squared Euclidean distances, whose root is only calculated at the end
+ * Every path of the matrix crosses each row, thus once the minimum of a row exceeds the threshold so does the distance and the minimum is returned as its lower bound */
+distance_t DiscreteFrechet::boundedDistance(const Curve &curveOne, const Curve &curveTwo, distance_t threshold) const {
+
+    unsigned int rows = curveOne.getComplexity();
+    unsigned int columns = curveTwo.getComplexity();
+
+    if (rows == 0 || columns == 0 || curveOne[0].getDimensions() != curveTwo[0].getDimensions())
         return CurveMetric::INVALID_PARAMETERS;
 
-    long double **distances = new long double *[curveOne.getComplexity()];
-    for (unsigned int i = 0; i < curveOne.getComplexity(); ++i)
-        distances[i] = new long double[curveTwo.getComplexity()];
+    unsigned int dimensions = curveOne[0].getDimensions();
 
-    distances[0][0] = VectorMetric::distance(curveOne[0], curveTwo[0], 2.0);
+    distance_t lowerBound = std::sqrt(std::max(DistanceKernels::squaredEuclidean(curveOne[0].getCoordinates(), curveTwo[0].getCoordinates(), dimensions),
+                                               DistanceKernels::squaredEuclidean(curveOne[rows - 1].getCoordinates(), curveTwo[columns - 1].getCoordinates(), dimensions)));
+    if (lowerBound > threshold)
+        return lowerBound;
 
+    lowerBound = CurveMetric::boundingBoxLowerBound(curveOne, curveTwo);
+    if (lowerBound > threshold)
+        return lowerBound;
 
-    for (unsigned int i = 0; i < curveOne.getComplexity(); ++i)
-        for (unsigned int j = 0; j < curveTwo.getComplexity(); ++j) {
+    thread_local std::vector<distance_t> buffer;
+    if (buffer.size() < 2 * (size_t) columns)
+        buffer.resize(2 * (size_t) columns);
 
-            if (i == 0 && j > 0)
-                distances[i][j] = std::max(distances[i][j - 1], VectorMetric::distance(curveOne[i], curveTwo[j], 2.0));
+    distance_t *previousRow = buffer.data();
+    distance_t *currentRow = buffer.data() + columns;
 
-            else if (i > 0 && j == 0)
-                distances[i][j] = std::max(distances[i - 1][j], VectorMetric::distance(curveOne[i], curveTwo[j], 2.0));
+    distance_t squaredThreshold = threshold * threshold;
 
-            else if (i > 0 && j > 0)
-                distances[i][j] = std::max(std::min(std::min(distances[i - 1][j], distances[i - 1][j - 1]), distances[i][j - 1]), VectorMetric::distance(curveOne[i], curveTwo[j], 2.0));
-        }
+    for (unsigned int i = 0; i < rows; ++i) {
 
+        const coordinate_t *pointOne = curveOne[i].getCoordinates();
+        distance_t rowMinimum = std::numeric_limits<distance_t>::max();
 
-    long double result = distances[curveOne.getComplexity() - 1][curveTwo.getComplexity() - 1];
+        for (unsigned int j = 0; j < columns; ++j) {
 
-    for (unsigned int i = 0; i < curveOne.getComplexity(); ++i)
-        delete[] distances[i];
+            distance_t squaredDistance = DistanceKernels::squaredEuclidean(pointOne, curveTwo[j].getCoordinates(), dimensions);
 
-    delete[] distances;
+            if (i == 0 && j == 0)
+                currentRow[j] = squaredDistance;
+
+            else if (i == 0)
+                currentRow[j] = std::max(currentRow[j - 1], squaredDistance);
+
+            else if (j == 0)
+                currentRow[j] = std::max(previousRow[j], squaredDistance);
+
+            else
+                currentRow[j] = std::max(std::min(std::min(previousRow[j], previousRow[j - 1]), currentRow[j - 1]), squaredDistance);
+
+            rowMinimum = std::min(rowMinimum, currentRow[j]);
+        }
+
+        /* The root is compared as well in order not to abandon a distance equal to the threshold due to the rounding of its square */
+        if (rowMinimum > squaredThreshold && std::sqrt(rowMinimum) > threshold)
+            return std::sqrt(rowMinimum);
+
+        std::swap(previousRow, currentRow);
+    }
 
-    return result;
+    return std::sqrt(previousRow[columns - 1]);
 }
 
 /* Utility function to calculate the Discrete Frechet optimal traversal of 2 Curves according to the slides that we were provided with */
@@ -49,9 +88,9 @@ std::vector<std::pair<Vector *, Vector *>> *DiscreteFrechet::getOptimalTraversal
     if (curveOne.getComplexity() == 0 || curveTwo.getComplexity() == 0)
         return nullptr;
 
-    long double **distances = new long double *[curveOne.getComplexity()];
+    distance_t **distances = new distance_t *[curveOne.getComplexity()];
     for (unsigned int i = 0; i < curveOne.getComplexity(); ++i)
-        distances[i] = new long double[curveTwo.getComplexity()];
+        distances[i] = new distance_t[curveTwo.getComplexity()];
 
     distances[0][0] = VectorMetric::distance(curveOne[0], curveTwo[0], 2.0);
 
@@ -79,7 +118,7 @@ std::vector<std::pair<Vector *, Vector *>> *DiscreteFrechet::getOptimalTraversal
 
         unsigned int iMin = i;
         unsigned int jMin = j;
-        long double minimumDistance = distances[i][j];
+        distance_t minimumDistance = distances[i][j];
 
         if (j > 0 && distances[i][j - 1] <= minimumDistance) {
             minimumDistance = distances[i][j - 1];
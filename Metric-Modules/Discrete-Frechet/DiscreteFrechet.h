@@ -11,7 +11,8 @@ class DiscreteFrechet : public CurveMetric {
 public:
     DiscreteFrechet();
     virtual ~DiscreteFrechet();
-    long double distance(const Curve &, const Curve &) const;
+    distance_t distance(const Curve &, const Curve &) const;
+    distance_t boundedDistance(const Curve &, const Curve &, distance_t) const;
     std::vector<std::pair<Vector *, Vector *>>* getOptimalTraversal(const Curve &, const Curve &) const;
 
 };
@@ -0,0 +1,135 @@
+#include <cmath>
+#include "DistanceKernels.h"
+
+/* The kernels are selected once, during the static initialization of the program */
+DistanceKernels::Kernel DistanceKernels::squaredEuclideanKernel = DistanceKernels::select(DistanceKernels::squaredEuclideanScalar, DistanceKernels::squaredEuclideanAVX2, DistanceKernels::squaredEuclideanAVX512);
+DistanceKernels::Kernel DistanceKernels::manhattanKernel = DistanceKernels::select(DistanceKernels::manhattanScalar, DistanceKernels::manhattanAVX2, DistanceKernels::manhattanAVX512);
+DistanceKernels::Kernel DistanceKernels::chebyshevKernel = DistanceKernels::select(DistanceKernels::chebyshevScalar, DistanceKernels::chebyshevAVX2, DistanceKernels::chebyshevAVX512);
+DistanceKernels::Kernel DistanceKernels::innerProductKernel = DistanceKernels::select(DistanceKernels::innerProductScalar, DistanceKernels::innerProductAVX2, DistanceKernels::innerProductAVX512);
+DistanceKernels::MatrixKernel DistanceKernels::innerProductsKernel = DistanceKernels::select(DistanceKernels::innerProductsScalar, DistanceKernels::innerProductsAVX2, DistanceKernels::innerProductsAVX512);
+const std::string DistanceKernels::instructionSet = DistanceKernels::selectInstructionSet();
+
+bool DistanceKernels::supportsAVX2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+bool DistanceKernels::supportsAVX512() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f");
+}
+
+/* Utility function to select the widest implementation of a kernel that the CPU supports */
+DistanceKernels::Kernel DistanceKernels::select(Kernel scalar, Kernel avx2, Kernel avx512) {
+
+    if (DistanceKernels::supportsAVX512())
+        return avx512;
+
+    if (DistanceKernels::supportsAVX2())
+        return avx2;
+
+    return scalar;
+}
+
+DistanceKernels::MatrixKernel DistanceKernels::select(MatrixKernel scalar, MatrixKernel avx2, MatrixKernel avx512) {
+
+    if (DistanceKernels::supportsAVX512())
+        return avx512;
+
+    if (DistanceKernels::supportsAVX2())
+        return avx2;
+
+    return scalar;
+}
+
+std::string DistanceKernels::selectInstructionSet() {
+
+    if (DistanceKernels::supportsAVX512())
+        return "AVX-512";
+
+    if (DistanceKernels::supportsAVX2())
+        return "AVX2";
+
+    return "Scalar";
+}
+
+const std::string &DistanceKernels::getInstructionSet() {
+    return DistanceKernels::instructionSet;
+}
+
+/* Utility function to calculate the squared Euclidean distance : (x_1 - y_1)^2 + (x_2 - y_2)^2 + ... + (x_i - y_i)^2 */
+distance_t DistanceKernels::squaredEuclidean(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return DistanceKernels::squaredEuclideanKernel(x, y, dimensions);
+}
+
+/* Utility function to calculate the Manhattan distance : |x_1 - y_1| + |x_2 - y_2| + ... + |x_i - y_i| */
+distance_t DistanceKernels::manhattan(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return DistanceKernels::manhattanKernel(x, y, dimensions);
+}
+
+/* Utility function to calculate the Chebyshev distance : max(|x_1 - y_1|, |x_2 - y_2|, ... , |x_i - y_i|) */
+distance_t DistanceKernels::chebyshev(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return DistanceKernels::chebyshevKernel(x, y, dimensions);
+}
+
+/* Utility function to calculate the inner product : x_1 * y_1 + x_2 * y_2 + ... + x_i * y_i */
+distance_t DistanceKernels::innerProduct(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return DistanceKernels::innerProductKernel(x, y, dimensions);
+}
+
+/* Utility function to calculate the inner products of x with each of the totalRows rows of a row-major matrix : results[i] = <row_i, x>
+ * Each result is identical to the one DistanceKernels::innerProduct would return for the corresponding row */
+void DistanceKernels::innerProducts(const coordinate_t *rows, unsigned int totalRows, const coordinate_t *x, unsigned int dimensions, distance_t *results) {
+    DistanceKernels::innerProductsKernel(rows, totalRows, x, dimensions, results);
+}
+
+distance_t DistanceKernels::squaredEuclideanScalar(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+    distance_t result = 0.0;
+
+    for (unsigned int i = 0; i < dimensions; ++i) {
+        distance_t difference = x[i] - y[i];
+        result += difference * difference;
+    }
+
+    return result;
+}
+
+distance_t DistanceKernels::manhattanScalar(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+    distance_t result = 0.0;
+
+    for (unsigned int i = 0; i < dimensions; ++i)
+        result += std::abs(x[i] - y[i]);
+
+    return result;
+}
+
+distance_t DistanceKernels::chebyshevScalar(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+    distance_t result = 0.0;
+
+    for (unsigned int i = 0; i < dimensions; ++i) {
+        distance_t difference = std::abs(x[i] - y[i]);
+        if (difference > result)
+            result = difference;
+    }
+
+    return result;
+}
+
+distance_t DistanceKernels::innerProductScalar(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+    distance_t result = 0.0;
+
+    for (unsigned int i = 0; i < dimensions; ++i)
+        result += x[i] * y[i];
+
+    return result;
+}
+
+void DistanceKernels::innerProductsScalar(const coordinate_t *rows, unsigned int totalRows, const coordinate_t *x, unsigned int dimensions, distance_t *results) {
+
+    for (unsigned int i = 0; i < totalRows; ++i)
+        results[i] = DistanceKernels::innerProductScalar(rows + (unsigned long int) i * dimensions, x, dimensions);
+}
@@ -0,0 +1,59 @@
+#ifndef DISTANCEKERNELS_H
+#define DISTANCEKERNELS_H
+
+#include <string>
+#include "../Continuous-Frechet/include/types.hpp"
+
+/* Static class that provides the innermost distance loops over raw coordinates
+ * Each kernel has a scalar, an AVX2 and an AVX-512 implementation and the widest one supported by the CPU is selected once at start-up */
+
+class DistanceKernels {
+
+private:
+    typedef distance_t (*Kernel)(const coordinate_t *, const coordinate_t *, unsigned int);
+    typedef void (*MatrixKernel)(const coordinate_t *, unsigned int, const coordinate_t *, unsigned int, distance_t *);
+
+    static Kernel squaredEuclideanKernel;
+    static Kernel manhattanKernel;
+    static Kernel chebyshevKernel;
+    static Kernel innerProductKernel;
+    static MatrixKernel innerProductsKernel;
+    static const std::string instructionSet;
+
+    static Kernel select(Kernel, Kernel, Kernel);
+    static MatrixKernel select(MatrixKernel, MatrixKernel, MatrixKernel);
+    static std::string selectInstructionSet();
+
+public:
+    static distance_t squaredEuclideanScalar(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t manhattanScalar(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t chebyshevScalar(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t innerProductScalar(const coordinate_t *, const coordinate_t *, unsigned int);
+    static void innerProductsScalar(const coordinate_t *, unsigned int, const coordinate_t *, unsigned int, distance_t *);
+
+    static distance_t squaredEuclideanAVX2(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t manhattanAVX2(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t chebyshevAVX2(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t innerProductAVX2(const coordinate_t *, const coordinate_t *, unsigned int);
+    static void innerProductsAVX2(const coordinate_t *, unsigned int, const coordinate_t *, unsigned int, distance_t *);
+
+    static distance_t squaredEuclideanAVX512(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t manhattanAVX512(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t chebyshevAVX512(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t innerProductAVX512(const coordinate_t *, const coordinate_t *, unsigned int);
+    static void innerProductsAVX512(const coordinate_t *, unsigned int, const coordinate_t *, unsigned int, distance_t *);
+
+    /* Dispatched kernels */
+    static distance_t squaredEuclidean(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t manhattan(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t chebyshev(const coordinate_t *, const coordinate_t *, unsigned int);
+    static distance_t innerProduct(const coordinate_t *, const coordinate_t *, unsigned int);
+    static void innerProducts(const coordinate_t *, unsigned int, const coordinate_t *, unsigned int, distance_t *);
+
+    static const std::string &getInstructionSet();
+    static bool supportsAVX2();
+    static bool supportsAVX512();
+};
+
+
+#endif
@@ -0,0 +1,25 @@
+/* AVX2 kernels. This translation unit is compiled with -mavx2 -mfma and its functions are only called if the CPU supports AVX2 */
+
+#define LANE_BYTES 32
+#include "DistanceKernelsLanes.hpp"
+#include "DistanceKernels.h"
+
+distance_t DistanceKernels::squaredEuclideanAVX2(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return squaredEuclideanLanes(x, y, dimensions);
+}
+
+distance_t DistanceKernels::manhattanAVX2(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return manhattanLanes(x, y, dimensions);
+}
+
+distance_t DistanceKernels::chebyshevAVX2(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return chebyshevLanes(x, y, dimensions);
+}
+
+distance_t DistanceKernels::innerProductAVX2(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return innerProductLanes(x, y, dimensions);
+}
+
+void DistanceKernels::innerProductsAVX2(const coordinate_t *rows, unsigned int totalRows, const coordinate_t *x, unsigned int dimensions, distance_t *results) {
+    innerProductsLanes(rows, totalRows, x, dimensions, results);
+}
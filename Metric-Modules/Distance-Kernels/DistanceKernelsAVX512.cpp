@@ -0,0 +1,25 @@
+/* AVX-512 kernels. This translation unit is compiled with -mavx512f and its functions are only called if the CPU supports AVX-512F */
+
+#define LANE_BYTES 64
+#include "DistanceKernelsLanes.hpp"
+#include "DistanceKernels.h"
+
+distance_t DistanceKernels::squaredEuclideanAVX512(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return squaredEuclideanLanes(x, y, dimensions);
+}
+
+distance_t DistanceKernels::manhattanAVX512(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return manhattanLanes(x, y, dimensions);
+}
+
+distance_t DistanceKernels::chebyshevAVX512(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return chebyshevLanes(x, y, dimensions);
+}
+
+distance_t DistanceKernels::innerProductAVX512(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+    return innerProductLanes(x, y, dimensions);
+}
+
+void DistanceKernels::innerProductsAVX512(const coordinate_t *rows, unsigned int totalRows, const coordinate_t *x, unsigned int dimensions, distance_t *results) {
+    innerProductsLanes(rows, totalRows, x, dimensions, results);
+}
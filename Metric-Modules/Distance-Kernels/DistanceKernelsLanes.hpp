@@ -0,0 +1,204 @@
+/* Width-generic implementation of the distance kernels, which is included by each instruction set specific translation unit
+ * LANE_BYTES should be defined before the inclusion and every function has internal linkage, thus each translation unit
+ * gets its own copy compiled with its own target flags */
+
+#ifndef LANE_BYTES
+#error "LANE_BYTES should be defined before including DistanceKernelsLanes.hpp"
+#endif
+
+#include <cstring>
+#include <cmath>
+#include "../Continuous-Frechet/include/types.hpp"
+
+namespace {
+
+    typedef coordinate_t Lane __attribute__((vector_size(LANE_BYTES)));
+
+    const unsigned int LANE_WIDTH = LANE_BYTES / sizeof(coordinate_t);
+
+    /* Unaligned load of LANE_WIDTH coordinates */
+    inline Lane load(const coordinate_t *coordinates) {
+        Lane lane;
+        std::memcpy(&lane, coordinates, sizeof(Lane));
+        return lane;
+    }
+
+    inline Lane absolute(Lane lane) {
+        return lane < 0 ? -lane : lane;
+    }
+
+    inline Lane maximum(Lane laneOne, Lane laneTwo) {
+        return laneOne > laneTwo ? laneOne : laneTwo;
+    }
+
+    inline distance_t sum(Lane lane) {
+
+        distance_t result = 0.0;
+        for (unsigned int i = 0; i < LANE_WIDTH; ++i)
+            result += lane[i];
+
+        return result;
+    }
+
+    inline distance_t max(Lane lane) {
+
+        distance_t result = lane[0];
+        for (unsigned int i = 1; i < LANE_WIDTH; ++i)
+            if (lane[i] > result)
+                result = lane[i];
+
+        return result;
+    }
+
+    /* Two independent accumulators are used to hide the latency of the additions */
+    distance_t squaredEuclideanLanes(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+        Lane accumulatorOne = {};
+        Lane accumulatorTwo = {};
+        unsigned int i = 0;
+
+        for (; i + 2 * LANE_WIDTH <= dimensions; i += 2 * LANE_WIDTH) {
+            Lane differenceOne = load(x + i) - load(y + i);
+            Lane differenceTwo = load(x + i + LANE_WIDTH) - load(y + i + LANE_WIDTH);
+            accumulatorOne += differenceOne * differenceOne;
+            accumulatorTwo += differenceTwo * differenceTwo;
+        }
+
+        for (; i + LANE_WIDTH <= dimensions; i += LANE_WIDTH) {
+            Lane difference = load(x + i) - load(y + i);
+            accumulatorOne += difference * difference;
+        }
+
+        distance_t result = sum(accumulatorOne + accumulatorTwo);
+
+        for (; i < dimensions; ++i) {
+            distance_t difference = x[i] - y[i];
+            result += difference * difference;
+        }
+
+        return result;
+    }
+
+    distance_t manhattanLanes(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+        Lane accumulatorOne = {};
+        Lane accumulatorTwo = {};
+        unsigned int i = 0;
+
+        for (; i + 2 * LANE_WIDTH <= dimensions; i += 2 * LANE_WIDTH) {
+            accumulatorOne += absolute(load(x + i) - load(y + i));
+            accumulatorTwo += absolute(load(x + i + LANE_WIDTH) - load(y + i + LANE_WIDTH));
+        }
+
+        for (; i + LANE_WIDTH <= dimensions; i += LANE_WIDTH)
+            accumulatorOne += absolute(load(x + i) - load(y + i));
+
+        distance_t result = sum(accumulatorOne + accumulatorTwo);
+
+        for (; i < dimensions; ++i)
+            result += std::abs(x[i] - y[i]);
+
+        return result;
+    }
+
+    distance_t chebyshevLanes(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+        Lane accumulator = {};
+        unsigned int i = 0;
+
+        for (; i + LANE_WIDTH <= dimensions; i += LANE_WIDTH)
+            accumulator = maximum(accumulator, absolute(load(x + i) - load(y + i)));
+
+        distance_t result = max(accumulator);
+
+        for (; i < dimensions; ++i) {
+            distance_t difference = std::abs(x[i] - y[i]);
+            if (difference > result)
+                result = difference;
+        }
+
+        return result;
+    }
+
+    distance_t innerProductLanes(const coordinate_t *x, const coordinate_t *y, unsigned int dimensions) {
+
+        Lane accumulatorOne = {};
+        Lane accumulatorTwo = {};
+        unsigned int i = 0;
+
+        for (; i + 2 * LANE_WIDTH <= dimensions; i += 2 * LANE_WIDTH) {
+            accumulatorOne += load(x + i) * load(y + i);
+            accumulatorTwo += load(x + i + LANE_WIDTH) * load(y + i + LANE_WIDTH);
+        }
+
+        for (; i + LANE_WIDTH <= dimensions; i += LANE_WIDTH)
+            accumulatorOne += load(x + i) * load(y + i);
+
+        distance_t result = sum(accumulatorOne + accumulatorTwo);
+
+        for (; i < dimensions; ++i)
+            result += x[i] * y[i];
+
+        return result;
+    }
+
+    /* Four rows are processed at a time, so that each load of x is shared by four inner products
+     * Each row keeps the same two accumulators as innerProductLanes, thus the results are identical to four separate calls */
+    void innerProductsLanes(const coordinate_t *rows, unsigned int totalRows, const coordinate_t *x, unsigned int dimensions, distance_t *results) {
+
+        unsigned int row = 0;
+
+        for (; row + 4 <= totalRows; row += 4) {
+
+            const coordinate_t *rowOne = rows + (unsigned long int) row * dimensions;
+            const coordinate_t *rowTwo = rowOne + dimensions;
+            const coordinate_t *rowThree = rowTwo + dimensions;
+            const coordinate_t *rowFour = rowThree + dimensions;
+
+            Lane accumulatorsOne[4] = {};
+            Lane accumulatorsTwo[4] = {};
+            unsigned int i = 0;
+
+            for (; i + 2 * LANE_WIDTH <= dimensions; i += 2 * LANE_WIDTH) {
+
+                Lane xOne = load(x + i);
+                Lane xTwo = load(x + i + LANE_WIDTH);
+
+                accumulatorsOne[0] += load(rowOne + i) * xOne;
+                accumulatorsTwo[0] += load(rowOne + i + LANE_WIDTH) * xTwo;
+                accumulatorsOne[1] += load(rowTwo + i) * xOne;
+                accumulatorsTwo[1] += load(rowTwo + i + LANE_WIDTH) * xTwo;
+                accumulatorsOne[2] += load(rowThree + i) * xOne;
+                accumulatorsTwo[2] += load(rowThree + i + LANE_WIDTH) * xTwo;
+                accumulatorsOne[3] += load(rowFour + i) * xOne;
+                accumulatorsTwo[3] += load(rowFour + i + LANE_WIDTH) * xTwo;
+            }
+
+            for (; i + LANE_WIDTH <= dimensions; i += LANE_WIDTH) {
+
+                Lane xLane = load(x + i);
+
+                accumulatorsOne[0] += load(rowOne + i) * xLane;
+                accumulatorsOne[1] += load(rowTwo + i) * xLane;
+                accumulatorsOne[2] += load(rowThree + i) * xLane;
+                accumulatorsOne[3] += load(rowFour + i) * xLane;
+            }
+
+            const coordinate_t *rowPointers[4] = {rowOne, rowTwo, rowThree, rowFour};
+
+            for (unsigned int j = 0; j < 4; ++j) {
+
+                distance_t result = sum(accumulatorsOne[j] + accumulatorsTwo[j]);
+
+                for (unsigned int l = i; l < dimensions; ++l)
+                    result += rowPointers[j][l] * x[l];
+
+                results[row + j] = result;
+            }
+        }
+
+        for (; row < totalRows; ++row)
+            results[row] = innerProductLanes(rows + (unsigned long int) row * dimensions, x, dimensions);
+    }
+
+}
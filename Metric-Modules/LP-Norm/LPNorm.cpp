@@ -1,13 +1,109 @@
 #include "LPNorm.h"
+#include "../Distance-Kernels/DistanceKernels.h"
 
-LPNorm::LPNorm(long double p) {
+/* Number of Points per block of the distance matrix, so that a block of rows and a block of columns fit in the L1/L2 cache */
+const unsigned int LPNorm::TILE_SIZE = 64;
+
+LPNorm::LPNorm(double p) {
     this->p = p;
 }
 
-long double LPNorm::distance(const Vector &vectorOne, const Vector &vectorTwo) {
+distance_t LPNorm::distance(const Vector &vectorOne, const Vector &vectorTwo) {
     return VectorMetric::distance(vectorOne, vectorTwo, this->p);
 }
 
-LPNorm::~LPNorm() {}
+/* Utility function to calculate the distance of a Vector from each Point of a set by calling the corresponding DistanceKernel directly */
+void LPNorm::distances(const Vector &vector, const std::vector<Point *> &points, std::vector<distance_t> &distances) {
+
+    distances.resize(points.size());
+
+    for (unsigned int i = 0; i < points.size(); ++i) {
+
+        if (points[i]->getDimensions() != vector.getDimensions())
+            distances[i] = VectorMetric::INVALID_PARAMETERS;
+
+        else if (this->p == 2)
+            distances[i] = std::sqrt(DistanceKernels::squaredEuclidean(vector.getCoordinates(), points[i]->getCoordinates(), vector.getDimensions()));
+
+        else if (this->p == 1)
+            distances[i] = DistanceKernels::manhattan(vector.getCoordinates(), points[i]->getCoordinates(), vector.getDimensions());
+
+        else if (this->p == 0)
+            distances[i] = DistanceKernels::chebyshev(vector.getCoordinates(), points[i]->getCoordinates(), vector.getDimensions());
+
+        else
+            distances[i] = VectorMetric::distance(vector, *points[i], this->p);
+    }
+}
+
+void LPNorm::distances(const std::vector<Point *> &rows, const std::vector<Point *> &columns, std::vector<distance_t> &matrix) {
+
+    if (this->p != 2) {
+        VectorMetric::distances(rows, columns, matrix);
+        return;
+    }
+
+    std::vector<distance_t> columnsSquaredNorms;
+    VectorMetric::squaredNorms(columns, columnsSquaredNorms);
+
+    this->distances(rows, columns, columnsSquaredNorms, matrix);
+}
+
+/* Utility function to calculate the Euclidean distance matrix of 2 sets of Points block by block according to the following formula :
+ * ||x - y||^2 = ||x||^2 + ||y||^2 - 2<x,y>, where the squared norms of the columns are provided and the squared norms of the rows are calculated once */
+void LPNorm::distances(const std::vector<Point *> &rows, const std::vector<Point *> &columns, const std::vector<distance_t> &columnsSquaredNorms, std::vector<distance_t> &matrix) {
+
+    if (this->p != 2 || columnsSquaredNorms.size() != columns.size()) {
+        VectorMetric::distances(rows, columns, matrix);
+        return;
+    }
 
+    /* All the Points should be of the same dimensions, otherwise the base class takes care of the invalid pairs */
+    unsigned int dimensions = rows.empty() ? 0 : rows[0]->getDimensions();
+    bool areDimensionsEqual = true;
 
+    for (Point *point: rows)
+        areDimensionsEqual = areDimensionsEqual && point->getDimensions() == dimensions;
+
+    for (Point *point: columns)
+        areDimensionsEqual = areDimensionsEqual && point->getDimensions() == dimensions;
+
+    if (!areDimensionsEqual) {
+        VectorMetric::distances(rows, columns, matrix);
+        return;
+    }
+
+    std::vector<distance_t> rowsSquaredNorms;
+    VectorMetric::squaredNorms(rows, rowsSquaredNorms);
+
+    matrix.resize(rows.size() * columns.size());
+
+    for (unsigned int rowBlock = 0; rowBlock < rows.size(); rowBlock += LPNorm::TILE_SIZE) {
+
+        unsigned int rowBlockEnd = std::min((unsigned int) rows.size(), rowBlock + LPNorm::TILE_SIZE);
+
+        for (unsigned int columnBlock = 0; columnBlock < columns.size(); columnBlock += LPNorm::TILE_SIZE) {
+
+            unsigned int columnBlockEnd = std::min((unsigned int) columns.size(), columnBlock + LPNorm::TILE_SIZE);
+
+            for (unsigned int i = rowBlock; i < rowBlockEnd; ++i) {
+
+                const coordinate_t *row = rows[i]->getCoordinates();
+
+                for (unsigned int j = columnBlock; j < columnBlockEnd; ++j) {
+
+                    distance_t innerProduct = DistanceKernels::innerProduct(row, columns[j]->getCoordinates(), dimensions);
+                    distance_t squaredDistance = rowsSquaredNorms[i] + columnsSquaredNorms[j] - 2 * innerProduct;
+
+                    /* Rounding errors may produce slightly negative values for (nearly) identical Points */
+                    if (squaredDistance < 0)
+                        squaredDistance = 0;
+
+                    matrix[i * columns.size() + j] = std::sqrt(squaredDistance);
+                }
+            }
+        }
+    }
+}
+
+LPNorm::~LPNorm() {}
@@ -9,12 +9,17 @@
 class LPNorm : public VectorMetric {
 
 private:
-    long double p = 2.0;
+    static const unsigned int TILE_SIZE;
+
+    double p = 2.0;
 
 public:
-    LPNorm(long double);
+    LPNorm(double);
     virtual ~LPNorm();
-    virtual long double distance(const Vector &, const Vector &);
+    virtual distance_t distance(const Vector &, const Vector &);
+    virtual void distances(const Vector &, const std::vector<Point *> &, std::vector<distance_t> &);
+    virtual void distances(const std::vector<Point *> &, const std::vector<Point *> &, std::vector<distance_t> &);
+    virtual void distances(const std::vector<Point *> &, const std::vector<Point *> &, const std::vector<distance_t> &, std::vector<distance_t> &);
 };
 
 
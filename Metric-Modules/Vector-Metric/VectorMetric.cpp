@@ -1,113 +1,129 @@
 #include "VectorMetric.h"
+#include "../Distance-Kernels/DistanceKernels.h"
 
-const long double VectorMetric::INVALID_PARAMETERS = std::numeric_limits<long double>::max();
+const distance_t VectorMetric::INVALID_PARAMETERS = std::numeric_limits<distance_t>::max();
 
 VectorMetric::~VectorMetric() {}
 
-/* Utility function to calculate the p-distance between 2 Vectors
- * The distance formula is the following : [(x_1 - y_1)^p + (x_2 - y_2)^p + ... + (x_i - y_i)^p]^(1/p) */
-long double VectorMetric::distance(const Vector &vectorOne, const Vector &vectorTwo, long double p) {
+/* Utility function to calculate the distance of a Vector from each Point of a set, distances[i] corresponds to points[i] */
+void VectorMetric::distances(const Vector &vector, const std::vector<Point *> &points, std::vector<distance_t> &distances) {
 
-    if (p < 0 || (vectorOne.getDimensions() != vectorTwo.getDimensions()))
-        return VectorMetric::INVALID_PARAMETERS;
+    distances.resize(points.size());
 
-    if (vectorOne.equals(vectorTwo))
-        return 0.0;
+    for (unsigned int i = 0; i < points.size(); ++i)
+        distances[i] = this->distance(vector, *points[i]);
+}
 
-    long double distance;
+/* Utility function to calculate the distance matrix of 2 sets of Points in row-major order, matrix[i * columns.size() + j] corresponds to (rows[i], columns[j]) */
+void VectorMetric::distances(const std::vector<Point *> &rows, const std::vector<Point *> &columns, std::vector<distance_t> &matrix) {
 
-    /* Chebyshev distance */
-    if (p == 0) {
+    matrix.resize(rows.size() * columns.size());
 
-        distance = std::abs(vectorOne.getCoordinates().at(0) - vectorTwo.getCoordinates().at(0));
+    for (unsigned int i = 0; i < rows.size(); ++i)
+        for (unsigned int j = 0; j < columns.size(); ++j)
+            matrix[i * columns.size() + j] = this->distance(*rows[i], *columns[j]);
+}
 
-        for (long unsigned i = 1; i < vectorOne.getDimensions(); ++i) {
-            long double newDistance = std::abs(vectorOne.getCoordinates().at(i) - vectorTwo.getCoordinates().at(i));
-            if (newDistance > distance)
-                distance = newDistance;
-        }
+/* Same as above, where the squared Euclidean norms of the columns have already been calculated by VectorMetric::squaredNorms
+ * The base class does not make use of them */
+void VectorMetric::distances(const std::vector<Point *> &rows, const std::vector<Point *> &columns, const std::vector<distance_t> &, std::vector<distance_t> &matrix) {
+    this->distances(rows, columns, matrix);
+}
 
-    }
+/* Utility function to calculate the squared Euclidean norm of each Point of a set */
+void VectorMetric::squaredNorms(const std::vector<Point *> &points, std::vector<distance_t> &squaredNorms) {
 
-    else {
+    squaredNorms.resize(points.size());
 
-        distance = 0.0;
+    for (unsigned int i = 0; i < points.size(); ++i)
+        squaredNorms[i] = VectorMetric::norm_p(*points[i], 2.0);
+}
 
-        for (long unsigned i = 0; i < vectorOne.getDimensions(); ++i)
-            distance += powl(vectorOne.getCoordinates().at(i) - vectorTwo.getCoordinates().at(i), p);
+/* Utility function to calculate the p-distance between 2 Vectors
+ * The distance formula is the following : [|x_1 - y_1|^p + |x_2 - y_2|^p + ... + |x_i - y_i|^p]^(1/p)
+ * The Chebyshev (p = 0), Manhattan (p = 1) and Euclidean (p = 2) distances are calculated by the corresponding DistanceKernels */
+distance_t VectorMetric::distance(const Vector &vectorOne, const Vector &vectorTwo, double p) {
 
-        distance = powl(distance, ((long double) 1.0 / p));
-    }
+    if (p < 0 || (vectorOne.getDimensions() != vectorTwo.getDimensions()))
+        return VectorMetric::INVALID_PARAMETERS;
 
+    if (p == 2)
+        return std::sqrt(DistanceKernels::squaredEuclidean(vectorOne.getCoordinates(), vectorTwo.getCoordinates(), vectorOne.getDimensions()));
 
-    return distance;
+    /* Chebyshev distance */
+    if (p == 0)
+        return DistanceKernels::chebyshev(vectorOne.getCoordinates(), vectorTwo.getCoordinates(), vectorOne.getDimensions());
+
+    if (p == 1)
+        return DistanceKernels::manhattan(vectorOne.getCoordinates(), vectorTwo.getCoordinates(), vectorOne.getDimensions());
+
+    return std::pow(VectorMetric::distance_p(vectorOne, vectorTwo, p), 1.0 / p);
 }
 
 /* Utility function to calculate the p-norm of a Vector
- * The norm formula is the following : [(x_1)^p + (x_2)^p + ... + (x_i)^p]^(1/p) */
-long double VectorMetric::norm(const Vector &vector, long double p) {
+ * The norm formula is the following : [|x_1|^p + |x_2|^p + ... + |x_i|^p]^(1/p) */
+distance_t VectorMetric::norm(const Vector &vector, double p) {
 
     if (p < 0)
         return VectorMetric::INVALID_PARAMETERS;
 
-    std::vector<long double> zeros(vector.getCoordinates().size(), 0.0);
-    Vector zeroVector(zeros);
-
-    return VectorMetric::distance(vector, zeroVector, p);
+    /* Chebyshev norm */
+    if (p == 0)
+        return VectorMetric::norm_p(vector, p);
 
+    return std::pow(VectorMetric::norm_p(vector, p), 1.0 / p);
 }
 
 /* Utility function to calculate the p-norm of a Vector without calculating the corresponding root
- * The norm_p formula is the following : [(x_1)^p + (x_2)^p + ... + (x_i)^p] */
-long double VectorMetric::norm_p(const Vector &vector, long double p) {
+ * The norm_p formula is the following : [|x_1|^p + |x_2|^p + ... + |x_i|^p] */
+distance_t VectorMetric::norm_p(const Vector &vector, double p) {
 
     if (p < 0)
         return VectorMetric::INVALID_PARAMETERS;
 
-    std::vector<long double> zeros(vector.getCoordinates().size(), 0.0);
-    Vector zeroVector(zeros);
+    const coordinate_t *coordinates = vector.getCoordinates();
+
+    if (p == 2)
+        return DistanceKernels::innerProduct(coordinates, coordinates, vector.getDimensions());
+
+    distance_t norm = 0.0;
 
-    return VectorMetric::distance_p(vector, zeroVector, p);
+    for (unsigned int i = 0; i < vector.getDimensions(); ++i) {
 
+        /* Chebyshev norm */
+        if (p == 0)
+            norm = std::max(norm, (distance_t) std::abs(coordinates[i]));
+        else
+            norm += std::pow(std::abs(coordinates[i]), p);
+    }
+
+    return norm;
 }
 
 /* Utility function to calculate the p-distance between 2 Vectors without calculating the corresponding root
- * The distance_p formula is the following : [(x_1 - y_1)^p + (x_2 - y_2)^p + ... + (x_i - y_i)^p] */
-long double VectorMetric::distance_p(const Vector &vectorOne, const Vector &vectorTwo, long double p) {
-
+ * The distance_p formula is the following : [|x_1 - y_1|^p + |x_2 - y_2|^p + ... + |x_i - y_i|^p] */
+distance_t VectorMetric::distance_p(const Vector &vectorOne, const Vector &vectorTwo, double p) {
 
     if (p < 0 || (vectorOne.getDimensions() != vectorTwo.getDimensions()))
         return VectorMetric::INVALID_PARAMETERS;
 
+    const coordinate_t *coordinatesOne = vectorOne.getCoordinates();
+    const coordinate_t *coordinatesTwo = vectorTwo.getCoordinates();
 
-    if (vectorOne.equals(vectorTwo))
-        return 0.0;
-
-
-    long double distance;
+    if (p == 2)
+        return DistanceKernels::squaredEuclidean(coordinatesOne, coordinatesTwo, vectorOne.getDimensions());
 
     /* Chebyshev distance */
-    if (p == 0) {
-
-        distance = std::abs(vectorOne.getCoordinates().at(0) - vectorTwo.getCoordinates().at(0));
+    if (p == 0)
+        return DistanceKernels::chebyshev(coordinatesOne, coordinatesTwo, vectorOne.getDimensions());
 
-        for (long unsigned i = 1; i < vectorOne.getDimensions(); ++i) {
-            long double newDistance = std::abs(vectorOne.getCoordinates().at(i) - vectorTwo.getCoordinates().at(i));
-            if (newDistance > distance)
-                distance = newDistance;
-        }
-
-    }
+    if (p == 1)
+        return DistanceKernels::manhattan(coordinatesOne, coordinatesTwo, vectorOne.getDimensions());
 
-    else {
+    distance_t distance = 0.0;
 
-        distance = 0.0;
-        for (long unsigned i = 0; i < vectorOne.getDimensions(); ++i)
-            distance += powl(vectorOne.getCoordinates().at(i) - vectorTwo.getCoordinates().at(i), p);
-    }
+    for (unsigned int i = 0; i < vectorOne.getDimensions(); ++i)
+        distance += std::pow(std::abs(coordinatesOne[i] - coordinatesTwo[i]), p);
 
     return distance;
 }
-
-
-
@@ -2,21 +2,28 @@
 #define VECTORMETRIC_H
 
 
-#include "../../Vector-Modules/Vector/Vector.h"
+#include <vector>
+#include "../../Vector-Modules/Point/Point.h"
 
 /* Abstract base class to implement any Vector metric */
 
 class VectorMetric {
 
 public:
-    const static long double INVALID_PARAMETERS;
+    const static distance_t INVALID_PARAMETERS;
     virtual ~VectorMetric();
     /* Pure virtual function as each derived class may calculate distance between two Vectors in a different way */
-    virtual long double distance(const Vector &, const Vector &) = 0;
-    static long double distance(const Vector &, const Vector &, long double);
-    static long double distance_p(const Vector &, const Vector &, long double);
-    static long double norm(const Vector &, long double);
-    static long double norm_p(const Vector &, long double);
+    virtual distance_t distance(const Vector &, const Vector &) = 0;
+    /* Batch functions that calculate the distances of a Vector from a set of Points, or the distance matrix of 2 sets of Points
+     * Derived classes may override them to avoid calling VectorMetric::distance once per pair */
+    virtual void distances(const Vector &, const std::vector<Point *> &, std::vector<distance_t> &);
+    virtual void distances(const std::vector<Point *> &, const std::vector<Point *> &, std::vector<distance_t> &);
+    virtual void distances(const std::vector<Point *> &, const std::vector<Point *> &, const std::vector<distance_t> &, std::vector<distance_t> &);
+    static void squaredNorms(const std::vector<Point *> &, std::vector<distance_t> &);
+    static distance_t distance(const Vector &, const Vector &, double);
+    static distance_t distance_p(const Vector &, const Vector &, double);
+    static distance_t norm(const Vector &, double);
+    static distance_t norm_p(const Vector &, double);
 };
 
 
@@ -4,10 +4,31 @@
 #include "../LSH-Modules/Curve-LSH-Modules/Grid/Grid.h"
 #include "../Metric-Modules/Discrete-Frechet/DiscreteFrechet.h"
 #include "../Metric-Modules/Continuous-Frechet/ContinuousFrechet.h"
+#include "../Metric-Modules/Continuous-Frechet/include/Frechet.hpp"
 #include "../Utilities/String/String.h"
 #include "../Utilities/Arithmetic/Arithmetic.h"
+#include "../Vector-Modules/Dataset/Dataset.h"
+#include "../Metric-Modules/Distance-Kernels/DistanceKernels.h"
+#include "../Metric-Modules/LP-Norm/LPNorm.h"
+#include "../Utilities/Parallel/Parallel.h"
+#include "../Hypercube-Modules/Hypercube/Hypercube.h"
+#include "../LSH-Modules/Vector-LSH-Modules/Vector-LSH/VectorLSH.h"
+#include "../Utilities/Bounded-Heap/BoundedHeap.h"
+#include "../Utilities/Visited-Set/VisitedSet.h"
+#include "../LSH-Modules/Curve-LSH-Modules/Curve-LSH/CurveLSH.h"
+#include "../Utilities/Parser/Parser.h"
+#include "../Utilities/Query-Stream/QueryStream.h"
+#include "../Utilities/Ground-Truth-Cache/GroundTruthCache.h"
+#include "../Utilities/Result-Writer/ResultWriter.h"
+#include "../Utilities/File/File.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <limits>
 #include <CUnit/CUnit.h>
 #include <random>
+#include <iomanip>
+#include <cmath>
 
 /* Utility function to test the Vector module */
 void UnitTest::testVector(void) {
@@ -48,10 +69,36 @@ void UnitTest::testVector(void) {
 
 
     /* The p-norm of a random unit Vector -normalised according to the p-norm - should be equal to 1 */
-    long double norm = 2.0;
+    double norm = 2.0;
     Vector *unitVector = Vector::randomUnitVector(10, norm);
     CU_ASSERT_DOUBLE_EQUAL(VectorMetric::norm_p(*unitVector, norm), 1.0, 0.0001);
     delete unitVector;
+
+    /* The point-segment functions of the Continuous Frechet Distance library should match their definitions in terms of the Vector operators
+     * The 20-dimensional Vectors exceed the stack coordinates of the functions */
+    for (unsigned int dimensions: {2, 20}) {
+
+        Vector *point = Vector::randomUnitVector(dimensions, 2.0);
+        Vector *lineStart = Vector::randomUnitVector(dimensions, 2.0);
+        Vector *lineEnd = Vector::randomUnitVector(dimensions, 2.0);
+
+        const Vector u = *lineEnd - *lineStart, v = *point - *lineStart;
+        parameter_t projectionParameter = std::min(std::max(v * u / (u * u), (parameter_t) 0), (parameter_t) 1);
+        CU_ASSERT(point->line_segment_dist_sqr(*lineStart, *lineEnd) == (*lineStart + u * projectionParameter).dist_sqr(*point));
+
+        Interval interval = point->ball_intersection_interval(0.5, *lineStart, *lineEnd);
+        if (!interval.empty()) {
+            Vector begin = *lineStart + u * interval.begin();
+            Vector end = *lineStart + u * interval.end();
+            CU_ASSERT(interval.begin() >= 0 && interval.end() <= 1);
+            CU_ASSERT_DOUBLE_EQUAL(begin.dist_sqr(*point), interval.begin() > 0 ? 0.5 : begin.dist_sqr(*point), 0.0001);
+            CU_ASSERT_DOUBLE_EQUAL(end.dist_sqr(*point), interval.end() < 1 ? 0.5 : end.dist_sqr(*point), 0.0001);
+        }
+
+        delete point;
+        delete lineStart;
+        delete lineEnd;
+    }
 }
 
 
@@ -59,21 +106,21 @@ void UnitTest::testVector(void) {
 void UnitTest::testDiscreteSnapping() {
 
     unsigned int totalTests = 5;
-    long double delta = Random::randomLongDouble(1.0, 50.0);
-    long double shift = Random::randomLongDouble(0, delta);
+    coordinate_t delta = Random::randomLongDouble(1.0, 50.0);
+    coordinate_t shift = Random::randomLongDouble(0, delta);
 
 
     for (unsigned int i = 0; i < totalTests; ++i) {
 
-        long double coordinate = Random::randomLongDouble(-50.0, 50.0);
-        long double ai = std::round((coordinate - shift) / delta);
-        long double mapping = (ai * delta) + shift;
+        coordinate_t coordinate = Random::randomLongDouble(-50.0, 50.0);
+        coordinate_t ai = std::round((coordinate - shift) / delta);
+        coordinate_t mapping = (ai * delta) + shift;
 
         /* Given the mapping M then either M, (M+delta) or (M-delta) will be the closest one to the corresponding coordinate  */
-        long double distance_1 = std::abs(mapping - coordinate);
-        long double distance_2 = std::abs((mapping + delta) - coordinate);
-        long double distance_3 = std::abs((mapping - delta) - coordinate);
-        long double minDistance = std::min(std::min(distance_1, distance_2), distance_3);
+        coordinate_t distance_1 = std::abs(mapping - coordinate);
+        coordinate_t distance_2 = std::abs((mapping + delta) - coordinate);
+        coordinate_t distance_3 = std::abs((mapping - delta) - coordinate);
+        coordinate_t minDistance = std::min(std::min(distance_1, distance_2), distance_3);
 
         /* M should be the mapping closest to the corresponding coordinate  */
         CU_ASSERT(distance_1 == minDistance);
@@ -88,7 +135,7 @@ void UnitTest::testGrid() {
     bool continuous = false;
     unsigned int vectorSpaceDimensions = 11;
     unsigned int gridDimensions = 2;
-    long double delta = 0.05;
+    coordinate_t delta = 0.05;
     Grid *grid = Grid::createGrid(vectorSpaceDimensions, gridDimensions, delta, continuous);
 
     Curve *curve = Curve::createCurve(gridDimensions);
@@ -149,13 +196,16 @@ void UnitTest::testFrechet() {
     DiscreteFrechet discreteFrechet;
     ContinuousFrechet continuousFrechet;
 
+    /* The Continuous-Frechet-Distance of identical Curves is bounded by the rounding error of the coordinates e.g. in case of float coordinates */
+    double continuousTolerance = std::max(0.000001, 1000 * (double) std::numeric_limits<coordinate_t>::epsilon());
+
     unsigned int curveDimensions = 2;
     unsigned int complexity = 20;
     Curve *curve = UnitTest::createRandomCurve(curveDimensions, complexity);
 
     /* Each one of the following Frechet distances should be equal to 0 */
     CU_ASSERT_DOUBLE_EQUAL(discreteFrechet.distance(*curve, *curve), 0.0, 0.000001);
-    CU_ASSERT_DOUBLE_EQUAL(continuousFrechet.distance(*curve, *curve), 0.0, 0.000001);
+    CU_ASSERT_DOUBLE_EQUAL(continuousFrechet.distance(*curve, *curve), 0.0, continuousTolerance);
 
     delete curve;
 
@@ -164,10 +214,69 @@ void UnitTest::testFrechet() {
     /* Each one of the following Frechet distances should be equal to 0 */
     curve = UnitTest::createRandomCurve(curveDimensions, curveDimensions);
     CU_ASSERT_DOUBLE_EQUAL(discreteFrechet.distance(*curve, *curve), 0.0, 0.000001);
-    CU_ASSERT_DOUBLE_EQUAL(continuousFrechet.distance(*curve, *curve), 0.0, 0.000001);
+    CU_ASSERT_DOUBLE_EQUAL(continuousFrechet.distance(*curve, *curve), 0.0, continuousTolerance);
 
 
     delete curve;
+
+    /* The Discrete-Frechet-Distance should be equal to the longest distance of the optimal traversal
+     * A bounded Discrete-Frechet-Distance should be exact unless it exceeds the threshold, in which case it should still exceed it */
+    for (unsigned int i = 0; i < 50; ++i) {
+
+        Curve *curveOne = UnitTest::createRandomCurve(2, 1 + i % 17);
+        Curve *curveTwo = UnitTest::createRandomCurve(2, 1 + (i * 7) % 23);
+
+        distance_t distance = discreteFrechet.distance(*curveOne, *curveTwo);
+
+        std::vector<std::pair<Vector *, Vector *>> *optimalTraversal = discreteFrechet.getOptimalTraversal(*curveOne, *curveTwo);
+        distance_t longestDistance = 0.0;
+        for (const std::pair<Vector *, Vector *> &pair: *optimalTraversal)
+            longestDistance = std::max(longestDistance, VectorMetric::distance(*pair.first, *pair.second, 2.0));
+        delete optimalTraversal;
+
+        CU_ASSERT(distance == longestDistance);
+        CU_ASSERT(discreteFrechet.boundedDistance(*curveOne, *curveTwo, distance) == distance);
+        CU_ASSERT(discreteFrechet.boundedDistance(*curveOne, *curveTwo, 2 * distance) == distance);
+        CU_ASSERT(discreteFrechet.boundedDistance(*curveOne, *curveTwo, distance / 2) > distance / 2);
+        CU_ASSERT(discreteFrechet.boundedDistance(*curveOne, *curveTwo, distance / 2) <= distance);
+
+        CU_ASSERT(discreteFrechet.isWithin(*curveOne, *curveTwo, distance));
+        CU_ASSERT(!discreteFrechet.isWithin(*curveOne, *curveTwo, distance / 2));
+
+        /* The lower bounds should not exceed either Frechet distance and a Continuous-Frechet-Distance should only be abandoned in case it exceeds the threshold
+         * The Continuous-Frechet-Distance is approximated from below within 1% of the exact one, thus the lower bounds may exceed it by as much and either decision widens its threshold by as much */
+        CU_ASSERT(CurveMetric::endpointsLowerBound(*curveOne, *curveTwo) <= distance + 0.000001);
+        CU_ASSERT(CurveMetric::boundingBoxLowerBound(*curveOne, *curveTwo) <= distance);
+
+        if (curveOne->getComplexity() >= 2 && curveTwo->getComplexity() >= 2) {
+
+            distance_t continuousDistance = continuousFrechet.distance(*curveOne, *curveTwo);
+
+            CU_ASSERT(CurveMetric::endpointsLowerBound(*curveOne, *curveTwo) <= 1.01 * continuousDistance);
+            CU_ASSERT(CurveMetric::boundingBoxLowerBound(*curveOne, *curveTwo) <= 1.01 * continuousDistance);
+            CU_ASSERT(continuousFrechet.boundedDistance(*curveOne, *curveTwo, continuousDistance) == continuousDistance);
+            CU_ASSERT(continuousFrechet.boundedDistance(*curveOne, *curveTwo, continuousDistance / 2) > continuousDistance / 2);
+            CU_ASSERT(continuousFrechet.isWithin(*curveOne, *curveTwo, continuousDistance));
+            CU_ASSERT(!continuousFrechet.isWithin(*curveOne, *curveTwo, continuousDistance / 2));
+
+            /* A bounded Continuous-Frechet-Distance should be identical to the unbounded one for any threshold that it does not exceed, while a threshold just below it should either be exceeded or not alter it
+             * Either decision should agree with the unbounded distance */
+            for (unsigned int j = 0; j <= 10; ++j) {
+
+                distance_t threshold = continuousDistance * (1 + j / 1000.0);
+                CU_ASSERT(continuousFrechet.boundedDistance(*curveOne, *curveTwo, threshold) == continuousDistance);
+                CU_ASSERT(continuousFrechet.isWithin(*curveOne, *curveTwo, threshold));
+
+                threshold = continuousDistance * (0.99 + j / 1000.0);
+                distance_t boundedDistance = continuousFrechet.boundedDistance(*curveOne, *curveTwo, threshold);
+                CU_ASSERT(boundedDistance > threshold || boundedDistance == continuousDistance);
+                CU_ASSERT(continuousFrechet.isWithin(*curveOne, *curveTwo, threshold) == (continuousDistance <= threshold));
+            }
+        }
+
+        delete curveOne;
+        delete curveTwo;
+    }
 }
 
 /* Utility function to test whether the String module */
@@ -232,6 +341,16 @@ void UnitTest::testArithmetic(void) {
     CU_ASSERT(Arithmetic::mod(A + B, M) == Arithmetic::mod(Arithmetic::mod(A, M) + Arithmetic::mod(B, M), M));
     CU_ASSERT(Arithmetic::mod(Arithmetic::mod(A, M) + Arithmetic::mod(B, M), M) < M);
 
+    /* Test Arithmetic::hammingDistance() */
+    CU_ASSERT(Arithmetic::hammingDistance(0b101, 0b010) == 3);
+    CU_ASSERT(Arithmetic::hammingDistance(0xFFFFFFFFFFFFFFFFULL, 0) == 64);
+    CU_ASSERT(Arithmetic::hammingDistance(0b1100, 0b1100) == 0);
+
+    /* Test Arithmetic::binomialCoefficient() */
+    CU_ASSERT_DOUBLE_EQUAL(Arithmetic::binomialCoefficient(14, 7), 3432.0, 0.000001);
+    CU_ASSERT_DOUBLE_EQUAL(Arithmetic::binomialCoefficient(64, 0), 1.0, 0.000001);
+    CU_ASSERT_DOUBLE_EQUAL(Arithmetic::binomialCoefficient(3, 4), 0.0, 0.000001);
+
 }
 
 /* Utility function to test the Random module */
@@ -295,8 +414,14 @@ void UnitTest::testCurve(void) {
     curveTwo->insert(v9);
     curveTwo->insert(v10);
 
+    /* The bounding box of the Curve should contain all of its Points */
+    CU_ASSERT(curveTwo->getMinimumCoordinates() == std::vector<coordinate_t>({0, 1}));
+    CU_ASSERT(curveTwo->getMaximumCoordinates() == std::vector<coordinate_t>({4, 5}));
+
     curveTwo->filter(2);
     CU_ASSERT(curveTwo->getComplexity() == 3);
+    CU_ASSERT(curveTwo->getMinimumCoordinates() == std::vector<coordinate_t>({0, 1}));
+    CU_ASSERT(curveTwo->getMaximumCoordinates() == std::vector<coordinate_t>({4, 5}));
 
     curvesPoints = curveTwo->getPoints();
     CU_ASSERT(curvesPoints[0]->equals(*v6));
@@ -308,6 +433,761 @@ void UnitTest::testCurve(void) {
 
 }
 
+/* Utility function to test the Dataset module */
+void UnitTest::testDataset(void) {
+
+    std::vector<Curve *> curves;
+    for (unsigned int i = 0; i < 5; ++i)
+        curves.push_back(UnitTest::createRandomCurve(2, 10));
+
+    Dataset *dataset = Dataset::createDataset(curves, true);
+    CU_ASSERT(dataset->getSize() == 5);
+    CU_ASSERT(dataset->getDimensions() == 20);
+
+    for (unsigned int i = 0; i < dataset->getSize(); ++i) {
+
+        Point *point = dataset->getPoint(i);
+
+        /* Each Point of the Dataset should be a view of the corresponding row and equal to the Curve's vectorial representation */
+        CU_ASSERT(point->isView());
+        CU_ASSERT(point->getCoordinates() == dataset->getRow(i));
+        CU_ASSERT(point->getCurve() == curves[i]);
+        CU_ASSERT(point->equals(*curves[i]->getVectorialRepresentation()));
+
+        /* Each row should start at a cache line boundary */
+        CU_ASSERT(reinterpret_cast<unsigned long>(dataset->getRow(i)) % 64 == 0);
+
+        /* The column-major layout should hold the same coordinates */
+        for (unsigned int j = 0; j < dataset->getDimensions(); ++j)
+            CU_ASSERT(dataset->getColumn(j)[i] == dataset->getRow(i)[j]);
+    }
+
+    /* A copy of a view should own its coordinates */
+    Point copy(*dataset->getPoint(0));
+    CU_ASSERT(!copy.isView());
+    CU_ASSERT(copy.equals(*dataset->getPoint(0)));
+
+    /* Curves with vectorial representations of different dimensions can't form a Dataset */
+    curves.push_back(UnitTest::createRandomCurve(2, 11));
+    CU_ASSERT(Dataset::createDataset(curves, false) == nullptr);
+
+    delete dataset;
+    for (Curve *curve: curves)
+        delete curve;
+}
+
+/* Utility function to test every distance kernel supported by the CPU against a reference computation */
+void UnitTest::testDistanceKernels(void) {
+
+    typedef distance_t (*Kernel)(const coordinate_t *, const coordinate_t *, unsigned int);
+
+    std::vector<Kernel> squaredEuclideanKernels = {DistanceKernels::squaredEuclideanScalar, DistanceKernels::squaredEuclidean};
+    std::vector<Kernel> manhattanKernels = {DistanceKernels::manhattanScalar, DistanceKernels::manhattan};
+    std::vector<Kernel> chebyshevKernels = {DistanceKernels::chebyshevScalar, DistanceKernels::chebyshev};
+    std::vector<Kernel> innerProductKernels = {DistanceKernels::innerProductScalar, DistanceKernels::innerProduct};
+
+    if (DistanceKernels::supportsAVX2()) {
+        squaredEuclideanKernels.push_back(DistanceKernels::squaredEuclideanAVX2);
+        manhattanKernels.push_back(DistanceKernels::manhattanAVX2);
+        chebyshevKernels.push_back(DistanceKernels::chebyshevAVX2);
+        innerProductKernels.push_back(DistanceKernels::innerProductAVX2);
+    }
+
+    if (DistanceKernels::supportsAVX512()) {
+        squaredEuclideanKernels.push_back(DistanceKernels::squaredEuclideanAVX512);
+        manhattanKernels.push_back(DistanceKernels::manhattanAVX512);
+        chebyshevKernels.push_back(DistanceKernels::chebyshevAVX512);
+        innerProductKernels.push_back(DistanceKernels::innerProductAVX512);
+    }
+
+    /* Dimensions that are not multiples of the lane widths exercise the remainder loops */
+    for (unsigned int dimensions = 1; dimensions <= 67; dimensions += 3) {
+
+        std::vector<coordinate_t> x;
+        std::vector<coordinate_t> y;
+        for (unsigned int i = 0; i < dimensions; ++i) {
+            x.push_back(Random::randomLongDouble(-10.0, 10.0));
+            y.push_back(Random::randomLongDouble(-10.0, 10.0));
+        }
+
+        double squaredEuclidean = 0.0;
+        double manhattan = 0.0;
+        double chebyshev = 0.0;
+        double innerProduct = 0.0;
+        for (unsigned int i = 0; i < dimensions; ++i) {
+            squaredEuclidean += (double) (x[i] - y[i]) * (x[i] - y[i]);
+            manhattan += std::abs((double) x[i] - y[i]);
+            chebyshev = std::max(chebyshev, std::abs((double) x[i] - y[i]));
+            innerProduct += (double) x[i] * y[i];
+        }
+
+        for (Kernel kernel: squaredEuclideanKernels)
+            CU_ASSERT_DOUBLE_EQUAL(kernel(x.data(), y.data(), dimensions), squaredEuclidean, 0.01);
+
+        for (Kernel kernel: manhattanKernels)
+            CU_ASSERT_DOUBLE_EQUAL(kernel(x.data(), y.data(), dimensions), manhattan, 0.01);
+
+        for (Kernel kernel: chebyshevKernels)
+            CU_ASSERT_DOUBLE_EQUAL(kernel(x.data(), y.data(), dimensions), chebyshev, 0.0001);
+
+        for (Kernel kernel: innerProductKernels)
+            CU_ASSERT_DOUBLE_EQUAL(kernel(x.data(), y.data(), dimensions), innerProduct, 0.01);
+    }
+
+    /* The Manhattan distance should not depend on the sign of the differences */
+    Vector vector1({0, 0});
+    Vector vector2({1, -1});
+    CU_ASSERT_DOUBLE_EQUAL(VectorMetric::distance(vector1, vector2, 1.0), 2.0, 0.000001);
+    CU_ASSERT_DOUBLE_EQUAL(VectorMetric::distance(vector1, vector2, 0.0), 1.0, 0.000001);
+    CU_ASSERT_DOUBLE_EQUAL(VectorMetric::distance_p(vector1, vector2, 2.0), 2.0, 0.000001);
+}
+
+/* Utility function to test the batched distance calculations of the LPNorm module */
+void UnitTest::testBatchDistances(void) {
+
+    const unsigned int dimensions = 37;
+
+    std::vector<Point *> rows;
+    std::vector<Point *> columns;
+    for (unsigned int i = 0; i < 70; ++i) {
+
+        std::vector<coordinate_t> coordinates;
+        for (unsigned int j = 0; j < dimensions; ++j)
+            coordinates.push_back(Random::randomLongDouble(-10.0, 10.0));
+
+        if (i < 30)
+            rows.push_back(new Point(coordinates));
+        else
+            columns.push_back(new Point(coordinates));
+    }
+
+    /* The batched distances should agree with the pairwise ones, regardless of the norm */
+    for (double p: {1.0, 2.0, 3.0}) {
+
+        LPNorm lpNorm(p);
+
+        std::vector<distance_t> distances;
+        lpNorm.distances(*rows[0], columns, distances);
+        CU_ASSERT(distances.size() == columns.size());
+        for (unsigned int j = 0; j < columns.size(); ++j)
+            CU_ASSERT_DOUBLE_EQUAL(distances[j], lpNorm.distance(*rows[0], *columns[j]), 0.001);
+
+        std::vector<distance_t> matrix;
+        lpNorm.distances(rows, columns, matrix);
+        CU_ASSERT(matrix.size() == rows.size() * columns.size());
+        for (unsigned int i = 0; i < rows.size(); ++i)
+            for (unsigned int j = 0; j < columns.size(); ++j)
+                CU_ASSERT_DOUBLE_EQUAL(matrix[i * columns.size() + j], lpNorm.distance(*rows[i], *columns[j]), 0.001);
+    }
+
+    /* The distance of a Point from itself should not become negative due to cancellation */
+    LPNorm lpNorm(2.0);
+    std::vector<distance_t> matrix;
+    lpNorm.distances(rows, rows, matrix);
+    for (unsigned int i = 0; i < rows.size(); ++i)
+        CU_ASSERT(matrix[i * rows.size() + i] >= 0.0 && matrix[i * rows.size() + i] < 0.01);
+
+    /* Points of different dimensions can't be compared */
+    Point point({1, 2});
+    std::vector<distance_t> distances;
+    lpNorm.distances(point, columns, distances);
+    CU_ASSERT(distances[0] == VectorMetric::INVALID_PARAMETERS);
+
+    for (Point *row: rows)
+        delete row;
+
+    for (Point *column: columns)
+        delete column;
+}
+
+/* Utility function to test the Parallel module */
+void UnitTest::testParallel(void) {
+
+    /* Each task should be executed exactly once, regardless of the number of threads */
+    for (unsigned int threads: {1u, 2u, 4u, 64u}) {
+
+        std::vector<unsigned int> executions(1000, 0);
+        Parallel::parallelFor(executions.size(), threads, [&](unsigned int i) { executions[i]++; });
+
+        bool executedOnce = true;
+        for (unsigned int execution: executions)
+            if (execution != 1)
+                executedOnce = false;
+
+        CU_ASSERT(executedOnce);
+    }
+
+    /* Nothing should be executed in case there are no tasks */
+    unsigned int totalExecutions = 0;
+    Parallel::parallelFor(0, 4, [&](unsigned int) { totalExecutions++; });
+    CU_ASSERT(totalExecutions == 0);
+
+    /* Each block should be executed exactly once and the blocks should cover every task */
+    std::vector<unsigned int> executions(1000, 0);
+    Parallel::parallelForBlocks(executions.size(), 64, 4, [&](unsigned int first, unsigned int last) {
+        for (unsigned int i = first; i < last; ++i)
+            executions[i]++;
+    });
+    CU_ASSERT(std::count(executions.begin(), executions.end(), 1) == (long int) executions.size());
+
+    /* The counting sort should be stable and independent of the number of threads */
+    std::vector<unsigned int> keys;
+    for (unsigned int i = 0; i < 1000; ++i)
+        keys.push_back(Random::randomInteger(0, 16));
+
+    std::vector<unsigned int> expectedOrder(keys.size());
+    for (unsigned int i = 0; i < keys.size(); ++i)
+        expectedOrder[i] = i;
+    std::stable_sort(expectedOrder.begin(), expectedOrder.end(), [&](unsigned int x, unsigned int y) { return keys[x] < keys[y]; });
+
+    for (unsigned int threads: {1u, 3u, 8u}) {
+
+        std::vector<unsigned int> offsets;
+        std::vector<unsigned int> order;
+        Parallel::countingSort(keys, 17, threads, offsets, order);
+
+        CU_ASSERT(order == expectedOrder);
+        CU_ASSERT(offsets.size() == 18 && offsets[0] == 0 && offsets[17] == keys.size());
+        for (unsigned int key = 0; key < 17; ++key)
+            CU_ASSERT(offsets[key + 1] - offsets[key] == (unsigned int) std::count(keys.begin(), keys.end(), key));
+    }
+
+    /* The same should stand in case there are more possible keys than keys e.g. a sparsely populated hash table */
+    std::vector<unsigned int> offsets;
+    std::vector<unsigned int> order;
+    Parallel::countingSort(keys, 5000, 64, offsets, order);
+    CU_ASSERT(order == expectedOrder);
+    CU_ASSERT(offsets.size() == 5001 && offsets[17] == keys.size() && offsets[5000] == keys.size());
+
+    CU_ASSERT(Parallel::getHardwareThreads() >= 1);
+
+    /* Only the threads of a parallel Parallel::parallelFor should be marked as such */
+    std::vector<unsigned int> insideParallelFor(2, 0);
+    Parallel::parallelFor(insideParallelFor.size(), 2, [&](unsigned int i) { insideParallelFor[i] = Parallel::isInsideParallelFor(); });
+    CU_ASSERT(insideParallelFor[0] == 1 && insideParallelFor[1] == 1);
+    CU_ASSERT(!Parallel::isInsideParallelFor());
+
+    /* The Continuous-Frechet-Distance of long Curves should not depend on whether it is calculated within a Parallel::parallelFor, where the library is asked for a serial calculation, or not
+     * Its free space is only propagated in parallel in case OpenMP is enabled (make OPENMP=1) */
+    Curve *curveOne = UnitTest::createRandomCurve(2, 300);
+    Curve *curveTwo = UnitTest::createRandomCurve(2, 300);
+    ContinuousFrechet continuousFrechet;
+
+    std::vector<distance_t> distances(2, 0.0);
+    Parallel::parallelFor(distances.size(), 2, [&](unsigned int i) { distances[i] = continuousFrechet.distance(*curveOne, *curveTwo); });
+    distance_t distance = continuousFrechet.distance(*curveOne, *curveTwo);
+    CU_ASSERT(distances[0] == distance && distances[1] == distance);
+
+    delete curveOne;
+    delete curveTwo;
+
+    /* The tiled wavefront propagation of a free space should reach exactly the parameters that the serial propagation reaches
+     * The tiles are processed in the same order by a single thread in case OpenMP is not enabled, thus they are tested in every build
+     * The complexities of the Curves are not multiples of the side of the tiles, so that partial tiles are covered as well */
+    curveOne = UnitTest::createRandomCurve(2, 150);
+    curveTwo = UnitTest::createRandomCurve(2, 333);
+    distance = continuousFrechet.distance(*curveOne, *curveTwo);
+
+    for (distance_t threshold: {distance / 2, distance, (distance_t) (1.01 * distance)}) {
+
+        Frechet::Continuous::FreeSpace serialFreeSpace, wavefrontFreeSpace;
+        serialFreeSpace.resize(curveOne->getComplexity(), curveTwo->getComplexity());
+        wavefrontFreeSpace.resize(curveOne->getComplexity(), curveTwo->getComplexity());
+
+        Frechet::Continuous::_initialize_free_space(threshold, *curveOne, *curveTwo, serialFreeSpace, false);
+        Frechet::Continuous::_initialize_free_space(threshold, *curveOne, *curveTwo, wavefrontFreeSpace, false);
+        Frechet::Continuous::_propagate_reachability(curveOne->getComplexity(), curveTwo->getComplexity(), serialFreeSpace, false);
+        Frechet::Continuous::_propagate_reachability(curveOne->getComplexity(), curveTwo->getComplexity(), wavefrontFreeSpace, true);
+
+        bool identical = true;
+        for (unsigned int i = 0; i < curveOne->getComplexity(); ++i)
+            for (unsigned int j = 0; j < curveTwo->getComplexity(); ++j) {
+                if (i < curveOne->getComplexity() - 1 && serialFreeSpace.reachable1(i, j) != wavefrontFreeSpace.reachable1(i, j))
+                    identical = false;
+                if (j < curveTwo->getComplexity() - 1 && serialFreeSpace.reachable2(i, j) != wavefrontFreeSpace.reachable2(i, j))
+                    identical = false;
+            }
+
+        CU_ASSERT(identical);
+    }
+
+    /* The free space should only be propagated up to its last cell in case the threshold is not exceeded */
+    CU_ASSERT(!Frechet::Continuous::less_than_or_equal(distance / 2, *curveOne, *curveTwo));
+    CU_ASSERT(Frechet::Continuous::less_than_or_equal(1.01 * distance, *curveOne, *curveTwo));
+
+    delete curveOne;
+    delete curveTwo;
+}
+
+/* Utility function to test the Hypercube module */
+void UnitTest::testHypercube(void) {
+
+    /* A RandomFunction should always map the same index to the same value */
+    RandomFunction randomFunction;
+    bool consistent = true;
+    for (long long int index = -100; index <= 100; ++index)
+        if (randomFunction.coinFlip(index) != randomFunction.coinFlip(index) || (randomFunction.coinFlip(index) != 0 && randomFunction.coinFlip(index) != 1))
+            consistent = false;
+    CU_ASSERT(consistent);
+
+    const unsigned int dimensions = 10;
+
+    std::vector<Point *> points;
+    for (unsigned int i = 0; i < 200; ++i) {
+
+        std::vector<coordinate_t> coordinates;
+        for (unsigned int j = 0; j < dimensions; ++j)
+            coordinates.push_back(Random::randomLongDouble(-10.0, 10.0));
+
+        points.push_back(new Point(coordinates));
+    }
+
+    Hypercube hypercube(dimensions, 2.0, 4, 4, 2, points.size());
+    for (Point *point: points)
+        hypercube.insertPoint(point);
+
+    /* Every Point should be retrievable from its Vertex, even after the VertexTable has grown several times */
+    VertexTable vertexTable;
+    for (unsigned int i = 0; i < points.size(); ++i)
+        vertexTable.insert((uint64_t) i * 0x100000001ULL, points[i]);
+    vertexTable.insert(0, points[1]);
+
+    bool retrievable = vertexTable.getSize() == points.size() && vertexTable.find(1) == nullptr;
+    for (unsigned int i = 0; i < points.size(); ++i)
+        if (vertexTable.find((uint64_t) i * 0x100000001ULL) == nullptr || vertexTable.find((uint64_t) i * 0x100000001ULL)->at(0) != points[i])
+            retrievable = false;
+    CU_ASSERT(retrievable);
+    CU_ASSERT(vertexTable.find(0)->size() == 2);
+
+    LPNorm lpNorm(2.0);
+
+    /* An inserted Point should be found in its own Vertex when queried concurrently */
+    std::vector<std::tuple<Point *, distance_t, double>> neighbors(points.size());
+    Parallel::parallelFor(points.size(), 4, [&](unsigned int i) {
+        neighbors[i] = hypercube.getApproximateNearestNeighbor(points[i], &lpNorm);
+    });
+
+    bool found = true;
+    for (unsigned int i = 0; i < points.size(); ++i)
+        if (std::get<0>(neighbors[i]) == nullptr || std::get<1>(neighbors[i]) != 0.0)
+            found = false;
+    CU_ASSERT(found);
+
+    /* If every Vertex of the Hypercube may be probed then every Point should be found */
+    Hypercube smallHypercube(dimensions, 2.0, 4, 4, 16, points.size());
+    for (Point *point: points)
+        smallHypercube.insertPoint(point);
+
+    std::vector<Point *> *similarPoints = smallHypercube.rangeSearch(points[0], std::numeric_limits<distance_t>::max(), &lpNorm);
+    CU_ASSERT(similarPoints->size() == points.size());
+    delete similarPoints;
+
+    for (Point *point: points)
+        delete point;
+}
+
+/* Utility function to test the VectorLSH module */
+void UnitTest::testVectorLSH(void) {
+
+    const unsigned int dimensions = 10;
+    const unsigned int k = 4;
+
+    std::vector<Point *> points;
+    for (unsigned int i = 0; i < 200; ++i) {
+
+        std::vector<coordinate_t> coordinates;
+        for (unsigned int j = 0; j < dimensions; ++j)
+            coordinates.push_back(Random::randomLongDouble(-10.0, 10.0));
+
+        points.push_back(new Point(coordinates));
+    }
+
+    /* Perturbing an h_i() value should produce the same amplified hash value as recalculating it from scratch */
+    LSHHashFunction lshHashFunction(dimensions, 2.0, 4, k);
+    bool consistent = true;
+    for (Point *point: points) {
+
+        long long int slots[k];
+        coordinate_t offsets[k];
+        unsigned int amplifiedHashValue = lshHashFunction.hash(*point, slots, offsets);
+
+        if (amplifiedHashValue != lshHashFunction.hash(*point) || amplifiedHashValue != lshHashFunction.combine(slots))
+            consistent = false;
+
+        for (unsigned int i = 0; i < k; ++i) {
+
+            if (offsets[i] < 0.0 || offsets[i] >= 1.0)
+                consistent = false;
+
+            for (int delta: {-1, 1}) {
+                slots[i] += delta;
+                if (lshHashFunction.perturb(amplifiedHashValue, i, slots[i] - delta, delta) != lshHashFunction.combine(slots))
+                    consistent = false;
+                slots[i] -= delta;
+            }
+        }
+    }
+    CU_ASSERT(consistent);
+
+    /* Points inserted in bulk and one by one should be retrievable from their buckets in insertion order */
+    ProjectionMatrix sharedProjectionMatrix(2 * k, dimensions, 4);
+    VectorLSHTable vectorLSHTable(0, sharedProjectionMatrix, k, 2.0, k, 16);
+    unsigned int half = points.size() / 2;
+    std::vector<coordinate_t> positions(points.size() * k);
+    std::vector<coordinate_t> sharedPositions(2 * k);
+    for (unsigned int i = 0; i < points.size(); ++i) {
+        vectorLSHTable.getProjectionMatrix().project(*points[i], positions.data() + i * k);
+
+        /* The hash table's projection matrix should be a view of the second half of the shared one */
+        sharedProjectionMatrix.project(*points[i], sharedPositions.data());
+        CU_ASSERT(std::equal(sharedPositions.begin() + k, sharedPositions.end(), positions.begin() + i * k));
+    }
+
+    std::vector<unsigned int> amplifiedHashValues;
+    for (unsigned int i = 0; i < half; ++i)
+        amplifiedHashValues.push_back(vectorLSHTable.hash(positions.data() + i * k));
+    vectorLSHTable.insert(amplifiedHashValues, 0, 4);
+    for (unsigned int i = half; i < points.size(); ++i)
+        vectorLSHTable.insert(positions.data() + i * k, i);
+
+    bool ordered = true;
+    std::vector<unsigned int> similarPoints;
+    for (unsigned int id = 0; id < points.size(); ++id) {
+
+        vectorLSHTable.getSimilarPoints(positions.data() + id * k, 0, 0, similarPoints);
+
+        /* The ids of the similar Points should contain the Point's own id and preserve the insertion order */
+        if (std::find(similarPoints.begin(), similarPoints.end(), id) == similarPoints.end())
+            ordered = false;
+
+        if (!std::is_sorted(similarPoints.begin(), similarPoints.end()))
+            ordered = false;
+    }
+    CU_ASSERT(ordered);
+
+    /* An id should only be visited once per query, until the VisitedSet is cleared for the next one */
+    VisitedSet visitedSet;
+    visitedSet.clear(points.size());
+    CU_ASSERT(visitedSet.visit(7));
+    CU_ASSERT(!visitedSet.visit(7));
+    CU_ASSERT(visitedSet.visit(8));
+    visitedSet.clear(2 * points.size());
+    CU_ASSERT(visitedSet.visit(7));
+    CU_ASSERT(visitedSet.visit(2 * points.size() - 1));
+    CU_ASSERT(!visitedSet.visit(2 * points.size() - 1));
+
+    /* An inserted Point should be its own approximate nearest neighbor, with or without multi-probing */
+    LPNorm lpNorm(2.0);
+    for (unsigned int probes: {0u, 10u}) {
+
+        VectorLSH vectorLSH(dimensions, 2.0, k, 4, 2, 16, 0, probes);
+        vectorLSH.build(points, 1);
+
+        bool found = true;
+        for (Point *point: points)
+            if (std::get<1>(vectorLSH.getApproximateNearestNeighbor(point, &lpNorm)) != 0.0)
+                found = false;
+        CU_ASSERT(found);
+    }
+
+    for (Point *point: points)
+        delete point;
+}
+
+/* Utility function to test the ProjectionMatrix module and the matrix-vector kernels it is based on */
+void UnitTest::testProjectionMatrix(void) {
+
+    typedef distance_t (*Kernel)(const coordinate_t *, const coordinate_t *, unsigned int);
+    typedef void (*MatrixKernel)(const coordinate_t *, unsigned int, const coordinate_t *, unsigned int, distance_t *);
+
+    std::vector<std::pair<MatrixKernel, Kernel>> kernels = {{DistanceKernels::innerProductsScalar, DistanceKernels::innerProductScalar},
+                                                            {DistanceKernels::innerProducts,       DistanceKernels::innerProduct}};
+
+    if (DistanceKernels::supportsAVX2())
+        kernels.push_back({DistanceKernels::innerProductsAVX2, DistanceKernels::innerProductAVX2});
+
+    if (DistanceKernels::supportsAVX512())
+        kernels.push_back({DistanceKernels::innerProductsAVX512, DistanceKernels::innerProductAVX512});
+
+    /* Each row's inner product should be identical to the one of the corresponding single-row kernel, including the rows that do not fill a block of four */
+    bool identical = true;
+    for (unsigned int dimensions = 1; dimensions <= 67; dimensions += 6)
+        for (unsigned int rows = 0; rows <= 9; ++rows) {
+
+            std::vector<coordinate_t> matrix;
+            std::vector<coordinate_t> x;
+            for (unsigned int i = 0; i < rows * dimensions; ++i)
+                matrix.push_back(Random::randomLongDouble(-10.0, 10.0));
+            for (unsigned int i = 0; i < dimensions; ++i)
+                x.push_back(Random::randomLongDouble(-10.0, 10.0));
+
+            for (const std::pair<MatrixKernel, Kernel> &kernel: kernels) {
+
+                std::vector<distance_t> results(rows);
+                kernel.first(matrix.data(), rows, x.data(), dimensions, results.data());
+
+                for (unsigned int i = 0; i < rows; ++i)
+                    if (results[i] != kernel.second(matrix.data() + i * dimensions, x.data(), dimensions))
+                        identical = false;
+            }
+        }
+    CU_ASSERT(identical);
+
+    /* The positions of a Point should be identical to the ones of the h_i() functions that the rows were taken from, even after stacking */
+    const unsigned int dimensions = 50;
+    const unsigned int rows = 6;
+
+    std::vector<LSHFunction *> lshFunctions;
+    ProjectionMatrix firstProjectionMatrix(rows / 2, dimensions, 4);
+    ProjectionMatrix secondProjectionMatrix(rows - rows / 2, dimensions, 4);
+    for (unsigned int i = 0; i < rows; ++i) {
+        lshFunctions.push_back(new LSHFunction(dimensions, 2.0, 4));
+        if (i < rows / 2)
+            firstProjectionMatrix.setRow(i, *lshFunctions[i]);
+        else
+            secondProjectionMatrix.setRow(i - rows / 2, *lshFunctions[i]);
+    }
+
+    ProjectionMatrix *stackedProjectionMatrix = ProjectionMatrix::createProjectionMatrix({&firstProjectionMatrix, &secondProjectionMatrix});
+    CU_ASSERT_FATAL(stackedProjectionMatrix != nullptr);
+    ProjectionMatrix &projectionMatrix = *stackedProjectionMatrix;
+    CU_ASSERT(projectionMatrix.getRows() == rows);
+    CU_ASSERT(projectionMatrix.getDimensions() == dimensions);
+
+    /* ProjectionMatrices of different dimensions or windows should not be stacked */
+    ProjectionMatrix otherDimensionsProjectionMatrix(1, dimensions - 1, 4);
+    ProjectionMatrix otherWindowProjectionMatrix(1, dimensions, 8);
+    CU_ASSERT(ProjectionMatrix::createProjectionMatrix({&firstProjectionMatrix, &otherDimensionsProjectionMatrix}) == nullptr);
+    CU_ASSERT(ProjectionMatrix::createProjectionMatrix({&otherDimensionsProjectionMatrix, &firstProjectionMatrix}) == nullptr);
+    CU_ASSERT(ProjectionMatrix::createProjectionMatrix({&firstProjectionMatrix, &otherWindowProjectionMatrix}) == nullptr);
+
+    identical = true;
+    for (unsigned int i = 0; i < 100; ++i) {
+
+        std::vector<coordinate_t> coordinates;
+        for (unsigned int j = 0; j < dimensions; ++j)
+            coordinates.push_back(Random::randomLongDouble(-10.0, 10.0));
+        Point point(coordinates);
+
+        coordinate_t positions[rows];
+        projectionMatrix.project(point, positions);
+
+        for (unsigned int j = 0; j < rows; ++j)
+            if (positions[j] != lshFunctions[j]->project(point))
+                identical = false;
+
+        /* A view of the stacked rows should project a Point exactly like the rows it shares */
+        ProjectionMatrix view(projectionMatrix, rows / 2, rows - rows / 2);
+        coordinate_t viewPositions[rows - rows / 2];
+        view.project(point, viewPositions);
+
+        for (unsigned int j = rows / 2; j < rows; ++j)
+            if (viewPositions[j - rows / 2] != positions[j])
+                identical = false;
+    }
+    CU_ASSERT(identical);
+
+    delete stackedProjectionMatrix;
+    for (LSHFunction *lshFunction: lshFunctions)
+        delete lshFunction;
+}
+
+/* Utility function to test the k nearest neighbors search of the BoundedHeap and VectorMethod modules */
+void UnitTest::testKNearestNeighbors(void) {
+
+    /* A BoundedHeap should keep the k smallest distances in ascending order and break ties by insertion order */
+    BoundedHeap<int> boundedHeap(3);
+    std::vector<distance_t> distances = {5.0, 1.0, 4.0, 1.0, 3.0, 9.0, 0.5};
+    for (unsigned int i = 0; i < distances.size(); ++i)
+        boundedHeap.push(i, distances[i]);
+
+    std::vector<std::pair<int, distance_t>> *kept = boundedHeap.toSortedVector();
+    CU_ASSERT(kept->size() == 3);
+    CU_ASSERT(kept->at(0).first == 6 && kept->at(1).first == 1 && kept->at(2).first == 3);
+    CU_ASSERT(boundedHeap.getWorstDistance() == 1.0);
+    delete kept;
+
+    BoundedHeap<int> emptyHeap(0);
+    CU_ASSERT(!emptyHeap.push(0, 0.0));
+
+    const unsigned int dimensions = 10;
+    const unsigned int k = 10;
+
+    std::vector<Point *> points;
+    for (unsigned int i = 0; i < 300; ++i) {
+
+        std::vector<coordinate_t> coordinates;
+        for (unsigned int j = 0; j < dimensions; ++j)
+            coordinates.push_back(Random::randomLongDouble(-10.0, 10.0));
+
+        points.push_back(new Point(coordinates));
+    }
+
+    LPNorm lpNorm(2.0);
+    VectorLSH vectorLSH(dimensions, 2.0, 4, 4, 3, 16, 0, 5);
+    Hypercube hypercube(dimensions, 2.0, 4, 4, 4, points.size());
+    for (Point *point: points)
+        vectorLSH.insertPoint(point);
+    hypercube.build(points, 4);
+
+    /* The exact k nearest neighbors should be the k smallest pairwise distances in ascending order */
+    std::vector<std::pair<Point *, distance_t>> *exactNeighbors = vectorLSH.getExactKNearestNeighbors(points[0], k, points, &lpNorm);
+
+    std::vector<distance_t> pairwiseDistances;
+    for (Point *point: points)
+        pairwiseDistances.push_back(lpNorm.distance(*points[0], *point));
+    std::sort(pairwiseDistances.begin(), pairwiseDistances.end());
+
+    CU_ASSERT(exactNeighbors->size() == k);
+    CU_ASSERT(exactNeighbors->at(0).first == points[0]);
+    for (unsigned int i = 0; i < exactNeighbors->size(); ++i)
+        CU_ASSERT_DOUBLE_EQUAL(exactNeighbors->at(i).second, pairwiseDistances[i], 0.0001);
+    delete exactNeighbors;
+
+    /* The approximate k nearest neighbors should be sorted, at most k, and start with the query Point itself as it was inserted */
+    for (VectorMethod *vectorMethod: std::vector<VectorMethod *>({&vectorLSH, &hypercube})) {
+
+        std::vector<std::pair<Point *, distance_t>> *approximateNeighbors = vectorMethod->getKNearestNeighbors(points[0], k, &lpNorm);
+
+        CU_ASSERT(!approximateNeighbors->empty() && approximateNeighbors->size() <= k);
+        CU_ASSERT(approximateNeighbors->at(0).second == 0.0);
+        for (unsigned int i = 1; i < approximateNeighbors->size(); ++i)
+            CU_ASSERT(approximateNeighbors->at(i - 1).second <= approximateNeighbors->at(i).second);
+
+        delete approximateNeighbors;
+    }
+
+    for (Point *point: points)
+        delete point;
+}
+
+void UnitTest::testIndexFile(void) {
+
+    const std::string indexFilePath = "unitTestIndex.bin";
+    const unsigned int complexity = 10;
+
+    std::vector<Curve *> curves;
+    for (unsigned int i = 0; i < 200; ++i)
+        curves.push_back(UnitTest::createRandomCurve(2, complexity));
+
+    Dataset *dataset = Dataset::createDataset(curves, false);
+    const std::vector<Point *> &points = dataset->getPoints();
+
+    LPNorm lpNorm(2.0);
+    DiscreteFrechet discreteFrechet;
+    VectorLSH vectorLSH(points[0]->getDimensions(), 2.0, 4, 40, 3, 16, 0, 2);
+    Hypercube hypercube(points[0]->getDimensions(), 2.0, 6, 40, 64, points.size());
+    CurveLSH curveLSH(points[0]->getDimensions(), 2.0, 4, 40, 3, 16, 0, 2, 1.0, false);
+    vectorLSH.build(points, 2);
+    hypercube.build(points, 2);
+    curveLSH.build(curves, 2);
+
+    /* A Curve should be written and read back as is */
+    IndexWriter *indexWriter = IndexWriter::createIndexWriter(indexFilePath, 7);
+    CU_ASSERT_FATAL(indexWriter != nullptr);
+    curves[0]->save(*indexWriter);
+    vectorLSH.save(*indexWriter, points);
+    hypercube.save(*indexWriter, points);
+    curveLSH.save(*indexWriter, curves);
+    CU_ASSERT(indexWriter->isValid());
+    delete indexWriter;
+
+    IndexReader *indexReader = IndexReader::createIndexReader(indexFilePath);
+    CU_ASSERT_FATAL(indexReader != nullptr);
+    CU_ASSERT(indexReader->getKind() == 7);
+
+    Curve *curve = Curve::createCurve(*indexReader);
+    CU_ASSERT_FATAL(curve != nullptr);
+    CU_ASSERT(curve->getDimensions() == 2 && curve->getComplexity() == complexity);
+    for (unsigned int i = 0; i < complexity; ++i)
+        CU_ASSERT((*curve)[i].equals((*curves[0])[i]));
+    delete curve;
+
+    VectorLSH loadedVectorLSH(*indexReader, points);
+    Hypercube loadedHypercube(*indexReader, points);
+    CurveLSH loadedCurveLSH(*indexReader, curves);
+    CU_ASSERT(indexReader->isValid());
+    delete indexReader;
+
+    /* The loaded data structures should answer every query exactly as the written ones */
+    for (unsigned int i = 0; i < 20; ++i) {
+
+        Curve *queryCurve = UnitTest::createRandomCurve(2, complexity);
+        Point *queryPoint = queryCurve->getVectorialRepresentation();
+
+        CU_ASSERT(std::get<0>(vectorLSH.getApproximateNearestNeighbor(queryPoint, &lpNorm)) == std::get<0>(loadedVectorLSH.getApproximateNearestNeighbor(queryPoint, &lpNorm)));
+        CU_ASSERT(std::get<0>(curveLSH.getApproximateNearestNeighbor(queryCurve, &discreteFrechet)) == std::get<0>(loadedCurveLSH.getApproximateNearestNeighbor(queryCurve, &discreteFrechet)));
+
+        /* The Hypercube visits its Vertices in a random order, thus only the k nearest neighbors among every visited Point are compared */
+        std::vector<std::pair<Point *, distance_t>> *neighbors = hypercube.getKNearestNeighbors(queryPoint, 5, &lpNorm);
+        std::vector<std::pair<Point *, distance_t>> *loadedNeighbors = loadedHypercube.getKNearestNeighbors(queryPoint, 5, &lpNorm);
+        CU_ASSERT(*neighbors == *loadedNeighbors);
+        delete neighbors;
+        delete loadedNeighbors;
+
+        delete queryCurve;
+    }
+
+    /* A truncated index file should be detected */
+    std::ifstream indexFile(indexFilePath, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(indexFile)), std::istreambuf_iterator<char>());
+    indexFile.close();
+
+    std::ofstream truncatedIndexFile(indexFilePath, std::ios::binary | std::ios::trunc);
+    truncatedIndexFile.write(bytes.data(), bytes.size() / 2);
+    truncatedIndexFile.close();
+
+    indexReader = IndexReader::createIndexReader(indexFilePath);
+    CU_ASSERT_FATAL(indexReader != nullptr);
+    curve = Curve::createCurve(*indexReader);
+    VectorLSH truncatedVectorLSH(*indexReader, points);
+    Hypercube truncatedHypercube(*indexReader, points);
+    CU_ASSERT(!indexReader->isValid());
+    delete curve;
+    delete indexReader;
+
+    /* An array size whose number of bytes overflows should be detected instead of wrapping around */
+    indexWriter = IndexWriter::createIndexWriter(indexFilePath, 7);
+    CU_ASSERT_FATAL(indexWriter != nullptr);
+    indexWriter->writeValue<uint64_t>((uint64_t) 1 << 61);
+    indexWriter->writeValue<uint64_t>((uint64_t) 1 << 61);
+    indexWriter->writeValue<uint64_t>(0);
+    delete indexWriter;
+
+    indexReader = IndexReader::createIndexReader(indexFilePath);
+    CU_ASSERT_FATAL(indexReader != nullptr);
+    std::vector<double> values(1, 1.0);
+    indexReader->readArray(values);
+    CU_ASSERT(values.empty() && !indexReader->isValid());
+    delete indexReader;
+
+    /* The same should stand for the size of a ProjectionMatrix, whose number of bytes is a multiple of 2^64 in case of double coordinates */
+    indexWriter = IndexWriter::createIndexWriter(indexFilePath, 7);
+    CU_ASSERT_FATAL(indexWriter != nullptr);
+    indexWriter->writeValue<uint32_t>((uint32_t) 1 << 31);
+    indexWriter->writeValue<uint32_t>(((uint32_t) 1 << 30) - 1);
+    indexWriter->writeValue<uint32_t>(4);
+    delete indexWriter;
+
+    indexReader = IndexReader::createIndexReader(indexFilePath);
+    CU_ASSERT_FATAL(indexReader != nullptr);
+    ProjectionMatrix corruptedProjectionMatrix(*indexReader);
+    CU_ASSERT(corruptedProjectionMatrix.getRows() == 0 && !indexReader->isValid());
+    delete indexReader;
+
+    /* A file that was not written by IndexWriter should be rejected */
+    std::ofstream invalidIndexFile(indexFilePath, std::ios::binary | std::ios::trunc);
+    invalidIndexFile << "Not an index file";
+    invalidIndexFile.close();
+    CU_ASSERT(IndexReader::createIndexReader(indexFilePath) == nullptr);
+
+    std::remove(indexFilePath.c_str());
+
+    delete dataset;
+    for (Curve *inputCurve: curves)
+        delete inputCurve;
+}
+
 /* Utility function to create a random Curve */
 Curve *UnitTest::createRandomCurve(unsigned int dimensions, unsigned int complexity) {
 
@@ -320,11 +1200,11 @@ Curve *UnitTest::createRandomCurve(unsigned int dimensions, unsigned int complex
 
 
     Curve *curve = Curve::createCurve(dimensions);
-    long double xCoordinate = 0.0;
+    coordinate_t xCoordinate = 0.0;
 
     for (unsigned int i = 0; i < complexity; ++i) {
 
-        std::vector<long double> coordinates;
+        std::vector<coordinate_t> coordinates;
 
         if (dimensions == 2) {
             coordinates.push_back(xCoordinate);
@@ -338,3 +1218,436 @@ Curve *UnitTest::createRandomCurve(unsigned int dimensions, unsigned int complex
 
     return curve;
 }
+
+/* Utility function to test the Parser module, which should parse exactly the Curves and the values that the line by line std::stold based parser used to */
+void UnitTest::testParser(void) {
+
+    /* Valid numbers, including some that need more than 19 significant digits or 27 decimal digits, should be converted exactly like std::stold does */
+    const std::vector<std::string> validNumbers = {"0", "-0", "1.5", "-0.000123", "+.25", "-.5", "0.1", "3.14159265358979323846", "+12345678901234567890.123",
+                                                   "0.0000000000000000000000000000001", "123456789012345678", "9999999999999999999"};
+
+    for (const std::string &number: validNumbers) {
+        long double value;
+        CU_ASSERT(String::parseFloatingPointNumber(number.data(), number.data() + number.size(), value));
+        CU_ASSERT((coordinate_t) value == (coordinate_t) std::stold(number));
+        CU_ASSERT(std::signbit(value) == std::signbit(std::stold(number)));
+    }
+
+    const std::vector<std::string> invalidNumbers = {"", "+", "-", "1.", ".5", "1.2.3", "1e5", "1,5", "12a", "1.5\r"};
+
+    for (const std::string &number: invalidNumbers) {
+        long double value;
+        CU_ASSERT(!String::parseFloatingPointNumber(number.data(), number.data() + number.size(), value));
+    }
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<unsigned int> digitDistribution(0, 9);
+    std::uniform_int_distribution<unsigned int> lengthDistribution(1, 24);
+
+    for (unsigned int i = 0; i < 10000; ++i) {
+
+        std::string number = (i % 2 == 0) ? "-" : "";
+
+        unsigned int integerDigits = lengthDistribution(generator);
+        for (unsigned int j = 0; j < integerDigits; ++j)
+            number += (char) ('0' + digitDistribution(generator));
+
+        if (i % 3 != 0) {
+            number += '.';
+            unsigned int decimalDigits = lengthDistribution(generator);
+            for (unsigned int j = 0; j < decimalDigits; ++j)
+                number += (char) ('0' + digitDistribution(generator));
+        }
+
+        long double value;
+        CU_ASSERT(String::parseFloatingPointNumber(number.data(), number.data() + number.size(), value));
+        CU_ASSERT(value == std::stold(number));
+    }
+
+    const std::string curvesFilePath = "unitTestCurves.txt";
+
+    std::ofstream curvesFile(curvesFilePath, std::ios::trunc);
+    curvesFile << "invalid\n";
+    curvesFile << "c0\t1.5\t2.5\t3.5\n";
+    curvesFile << "c1\t1.5\tx\t3\n";
+    curvesFile << "c2\t1\t2\n";
+    curvesFile << "c3\t-1\t+2\t.5\n";
+    curvesFile << "c4\t0.25\t\t1\n";
+    curvesFile << "\n";
+    curvesFile << "c5\t4\t-5\t6\t\n";
+    curvesFile << "c6\t7\t8\t9";
+    curvesFile.close();
+
+    CU_ASSERT(Parser::parseCurvesFile(curvesFilePath, 3, 1.0, 0, 1) == nullptr);
+
+    /* The complexity of the first valid Curve is used */
+    std::vector<Curve *> *curves = Parser::parseCurvesFile(curvesFilePath, 2, 0.5, 0, 1);
+    CU_ASSERT_FATAL(curves->size() == 3);
+    CU_ASSERT(curves->at(0)->getID() == "c0" && curves->at(1)->getID() == "c5" && curves->at(2)->getID() == "c6");
+
+    for (Curve *curve: *curves) {
+        CU_ASSERT(curve->getDimensions() == 2 && curve->getComplexity() == 3);
+        for (unsigned int i = 0; i < curve->getComplexity(); ++i)
+            CU_ASSERT((*curve)[i][0] == (coordinate_t) (0.5 * i));
+    }
+
+    CU_ASSERT((*curves->at(0))[2][1] == (coordinate_t) 3.5);
+    CU_ASSERT((*curves->at(1))[1][1] == (coordinate_t) -5);
+
+    for (Curve *curve: *curves)
+        delete curve;
+    delete curves;
+
+    /* An explicitly provided complexity is respected */
+    curves = Parser::parseCurvesFile(curvesFilePath, 1, 1.0, 2, 1);
+    CU_ASSERT_FATAL(curves->size() == 1);
+    CU_ASSERT(curves->at(0)->getID() == "c2" && curves->at(0)->getDimensions() == 1 && (*curves->at(0))[1][0] == 2);
+    delete curves->at(0);
+    delete curves;
+
+    /* A file large enough to be split among threads should be parsed exactly like it is parsed serially */
+    curvesFile.open(curvesFilePath, std::ios::trunc);
+    std::uniform_real_distribution<double> valueDistribution(-1000.0, 1000.0);
+
+    for (unsigned int i = 0; i < 20000; ++i) {
+        curvesFile << "curve" << i;
+        for (unsigned int j = 0; j < (i % 1000 == 999 ? 5 : 10); ++j)
+            curvesFile << '\t' << std::setprecision(17) << valueDistribution(generator);
+        curvesFile << '\n';
+    }
+
+    curvesFile.close();
+
+    std::vector<Curve *> *serialCurves = Parser::parseCurvesFile(curvesFilePath, 1, 1.0, 0, 1);
+    std::vector<Curve *> *parallelCurves = Parser::parseCurvesFile(curvesFilePath, 1, 1.0, 0, 4);
+
+    CU_ASSERT_FATAL(serialCurves->size() == 19980 && parallelCurves->size() == serialCurves->size());
+
+    bool areEqual = true;
+    for (unsigned int i = 0; i < serialCurves->size(); ++i) {
+        if (serialCurves->at(i)->getID() != parallelCurves->at(i)->getID() || serialCurves->at(i)->getComplexity() != parallelCurves->at(i)->getComplexity())
+            areEqual = false;
+        else
+            for (unsigned int j = 0; j < serialCurves->at(i)->getComplexity(); ++j)
+                if ((*serialCurves->at(i))[j][0] != (*parallelCurves->at(i))[j][0])
+                    areEqual = false;
+    }
+
+    CU_ASSERT(areEqual);
+
+    for (unsigned int i = 0; i < serialCurves->size(); ++i) {
+        delete serialCurves->at(i);
+        delete parallelCurves->at(i);
+    }
+
+    delete serialCurves;
+    delete parallelCurves;
+
+    std::remove(curvesFilePath.c_str());
+
+    /* A missing file results in no Curves */
+    curves = Parser::parseCurvesFile(curvesFilePath, 1, 1.0, 0, 1);
+    CU_ASSERT(curves != nullptr && curves->empty());
+    delete curves;
+}
+
+/* Utility function to test that binary Curves files hold exactly the Curves of the text file they were converted from */
+void UnitTest::testBinaryCurvesFile(void) {
+
+    const std::string curvesFilePath = "unitTestCurves.txt";
+    const std::string binaryFilePath = "unitTestCurves.bin";
+
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> valueDistribution(-100.0, 100.0);
+
+    std::ofstream curvesFile(curvesFilePath, std::ios::trunc);
+
+    for (unsigned int i = 0; i < 500; ++i) {
+        curvesFile << "id" << std::string(i % 7, 'x') << i;
+        for (unsigned int j = 0; j < 12; ++j)
+            curvesFile << '\t' << std::setprecision(17) << valueDistribution(generator);
+        curvesFile << '\n';
+    }
+
+    curvesFile.close();
+
+    CU_ASSERT(!Parser::isBinaryCurvesFile(curvesFilePath));
+
+    std::vector<Curve *> *textCurves = Parser::parseCurvesFile(curvesFilePath, 1, 1.0, 0, 1);
+    CU_ASSERT_FATAL(textCurves->size() == 500);
+
+    CU_ASSERT(!Parser::writeBinaryCurvesFile(binaryFilePath, *textCurves, 2));
+
+    for (uint32_t coordinateSize: {(uint32_t) sizeof(float), (uint32_t) sizeof(double)}) {
+
+        CU_ASSERT_FATAL(Parser::writeBinaryCurvesFile(binaryFilePath, *textCurves, coordinateSize));
+        CU_ASSERT(Parser::isBinaryCurvesFile(binaryFilePath));
+
+        /* Time-series are read both as 1-dimensional and as 2-dimensional Curves */
+        for (unsigned int dimensions = 1; dimensions <= 2; ++dimensions) {
+
+            std::vector<Curve *> *binaryCurves = Parser::parseCurvesFile(binaryFilePath, dimensions, 0.5, 0, 4);
+            CU_ASSERT_FATAL(binaryCurves->size() == textCurves->size());
+
+            bool areEqual = true;
+
+            for (unsigned int i = 0; i < textCurves->size(); ++i) {
+
+                Curve *textCurve = textCurves->at(i);
+                Curve *binaryCurve = binaryCurves->at(i);
+
+                if (binaryCurve->getID() != textCurve->getID() || binaryCurve->getDimensions() != dimensions || binaryCurve->getComplexity() != textCurve->getComplexity()) {
+                    areEqual = false;
+                    continue;
+                }
+
+                for (unsigned int j = 0; j < textCurve->getComplexity(); ++j) {
+
+                    coordinate_t expected = (coordinateSize == sizeof(float)) ? (coordinate_t) (float) (*textCurve)[j][0] : (*textCurve)[j][0];
+
+                    if ((*binaryCurve)[j][dimensions - 1] != expected || (dimensions == 2 && (*binaryCurve)[j][0] != (coordinate_t) (0.5 * j)))
+                        areEqual = false;
+                }
+            }
+
+            CU_ASSERT(areEqual);
+
+            for (Curve *curve: *binaryCurves)
+                delete curve;
+            delete binaryCurves;
+        }
+
+        /* A complexity other than the stored one results in no Curves */
+        std::vector<Curve *> *binaryCurves = Parser::parseCurvesFile(binaryFilePath, 1, 1.0, 5, 1);
+        CU_ASSERT(binaryCurves->empty());
+        delete binaryCurves;
+    }
+
+    /* A truncated file results in no Curves rather than in a read past its end */
+    std::ifstream binaryFile(binaryFilePath, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(binaryFile)), std::istreambuf_iterator<char>());
+    binaryFile.close();
+
+    std::ofstream truncatedFile(binaryFilePath, std::ios::binary | std::ios::trunc);
+    truncatedFile.write(contents.data(), contents.size() - 1);
+    truncatedFile.close();
+
+    std::vector<Curve *> *binaryCurves = Parser::parseCurvesFile(binaryFilePath, 1, 1.0, 0, 1);
+    CU_ASSERT(binaryCurves->empty());
+    delete binaryCurves;
+
+    for (Curve *curve: *textCurves)
+        delete curve;
+    delete textCurves;
+
+    std::remove(curvesFilePath.c_str());
+    std::remove(binaryFilePath.c_str());
+}
+
+/* Utility function to test the QueryStream module, which should yield the valid Queries of the stream in order and in batches of bounded size */
+void UnitTest::testQueryStream(void) {
+
+    const std::string streamFilePath = "unitTestStream.txt";
+
+    std::ofstream streamFile(streamFilePath, std::ios::trunc);
+    streamFile << "q0\t1\t2\t3\n";
+    streamFile << "q1\t1\t2\n";
+    streamFile << "invalid line\n";
+    streamFile << "q2\t4\t5\t6\n";
+    streamFile << "\n";
+    streamFile << "q3\t7\t8\t9\n";
+    streamFile << "q4\t1.5\t2.5\t3.5";
+    streamFile.close();
+
+    CU_ASSERT(QueryStream::createQueryStream("missingStreamFile.txt", 1, 1.0, 3, 2) == nullptr);
+    CU_ASSERT(QueryStream::createQueryStream(streamFilePath, 3, 1.0, 3, 2) == nullptr);
+
+    QueryStream *queryStream = QueryStream::createQueryStream(streamFilePath, 2, 1.0, 3, 2);
+    CU_ASSERT_FATAL(queryStream != nullptr);
+
+    std::vector<std::string> ids;
+    std::vector<Curve *> *queryCurves;
+
+    /* The rejected lines are placed among the Query Curves in the order of the stream, except for the blank line */
+    while ((queryCurves = queryStream->nextBatch()) != nullptr) {
+
+        const std::vector<std::pair<unsigned int, std::string>> &rejectedLines = queryStream->getRejectedLines();
+        CU_ASSERT(queryCurves->size() + rejectedLines.size() > 0 && queryCurves->size() + rejectedLines.size() <= 2);
+
+        for (unsigned int i = 0; i <= queryCurves->size(); ++i) {
+
+            for (const std::pair<unsigned int, std::string> &rejectedLine: rejectedLines)
+                if (rejectedLine.first == i)
+                    ids.push_back("rejected " + rejectedLine.second);
+
+            if (i == queryCurves->size())
+                break;
+
+            CU_ASSERT(queryCurves->at(i)->getDimensions() == 2 && queryCurves->at(i)->getComplexity() == 3);
+            ids.push_back(queryCurves->at(i)->getID());
+            delete queryCurves->at(i);
+        }
+
+        delete queryCurves;
+    }
+
+    CU_ASSERT(ids == std::vector<std::string>({"q0", "rejected q1", "rejected line 3", "q2", "q3", "q4"}));
+
+    /* An exhausted stream stays exhausted */
+    CU_ASSERT(queryStream->nextBatch() == nullptr);
+
+    delete queryStream;
+
+    std::remove(streamFilePath.c_str());
+}
+
+/* Utility function to test the GroundTruthCache module, whose entries should only be reused for the same Input Curves and metric */
+void UnitTest::testGroundTruthCache(void) {
+
+    const std::string cacheFilePath = "unitTestGroundTruth.bin";
+    std::remove(cacheFilePath.c_str());
+
+    std::vector<Curve *> inputCurves;
+    for (unsigned int i = 0; i < 20; ++i)
+        inputCurves.push_back(UnitTest::createRandomCurve(2, 10));
+
+    Curve *queryCurve = UnitTest::createRandomCurve(2, 10);
+    Curve *otherQueryCurve = UnitTest::createRandomCurve(2, 10);
+
+    uint64_t queryHash = GroundTruthCache::hashCurve(*queryCurve);
+    CU_ASSERT(queryHash == GroundTruthCache::hashCurve(*queryCurve));
+    CU_ASSERT(queryHash != GroundTruthCache::hashCurve(*otherQueryCurve));
+
+    std::tuple<std::string, distance_t, double> exactNeighbor;
+
+    /* A missing cache file results in an empty cache */
+    GroundTruthCache *groundTruthCache = GroundTruthCache::createGroundTruthCache(cacheFilePath, inputCurves, "discrete");
+    CU_ASSERT_FATAL(groundTruthCache != nullptr);
+    CU_ASSERT(groundTruthCache->getSize() == 0 && !groundTruthCache->find(queryHash, exactNeighbor));
+
+    groundTruthCache->insert(queryHash, std::make_tuple("neighbor", (distance_t) 1.25, 3.0));
+    CU_ASSERT(groundTruthCache->save());
+    delete groundTruthCache;
+
+    groundTruthCache = GroundTruthCache::createGroundTruthCache(cacheFilePath, inputCurves, "discrete");
+    CU_ASSERT(groundTruthCache->getSize() == 1 && groundTruthCache->find(queryHash, exactNeighbor));
+    CU_ASSERT(std::get<0>(exactNeighbor) == "neighbor" && std::get<1>(exactNeighbor) == (distance_t) 1.25 && std::get<2>(exactNeighbor) == 3.0);
+    CU_ASSERT(!groundTruthCache->find(GroundTruthCache::hashCurve(*otherQueryCurve), exactNeighbor));
+    delete groundTruthCache;
+
+    /* Another metric or other Input Curves invalidate the cache */
+    groundTruthCache = GroundTruthCache::createGroundTruthCache(cacheFilePath, inputCurves, "continuous");
+    CU_ASSERT(groundTruthCache->getSize() == 0);
+    delete groundTruthCache;
+
+    delete inputCurves.back();
+    inputCurves.pop_back();
+
+    groundTruthCache = GroundTruthCache::createGroundTruthCache(cacheFilePath, inputCurves, "discrete");
+    CU_ASSERT(groundTruthCache->getSize() == 0);
+    delete groundTruthCache;
+
+    for (Curve *curve: inputCurves)
+        delete curve;
+
+    delete queryCurve;
+    delete otherQueryCurve;
+
+    std::remove(cacheFilePath.c_str());
+}
+
+/* Utility function to test the ResultWriter module, whose text format should match the layout described in the README -- section Output file */
+void UnitTest::testResultWriter(void) {
+
+    const std::string outputFilePath = "unitTestResults.txt";
+    std::remove(outputFilePath.c_str());
+
+    CU_ASSERT(ResultWriter::createResultWriter(outputFilePath, "binary") == nullptr);
+
+    std::vector<std::pair<std::string, std::string>> parameters = {{"Algorithm", "LSH_Vector"},
+                                                                   {"L",         std::to_string(5)}};
+
+    std::string approximateID = "item\"1\"";
+    std::string trueID = "item2";
+
+    std::vector<std::string> expectedContents = {"\n\n--Execution parameters--\n"
+                                                 "\nAlgorithm : LSH_Vector"
+                                                 "\nL : 5"
+                                                 "\n\nQuery : query1"
+                                                 "\nApproximate Nearest Neighbor : item\"1\""
+                                                 "\nTrue Nearest Neighbor : item2"
+                                                 "\ndistanceApproximate : " + std::to_string((distance_t) 2.5) +
+                                                 "\ndistanceTrue : " + std::to_string((distance_t) 1.25) +
+                                                 "\ntimeApproximate : " + std::to_string(0.125) + " ms"
+                                                 "\ntimeTrue : " + std::to_string(3.0) + " ms"
+                                                 "\n\nQuery : query2"
+                                                 "\nApproximate Nearest Neighbor : N/A"
+                                                 "\nTrue Nearest Neighbor : N/A"
+                                                 "\ndistanceApproximate : N/A"
+                                                 "\ndistanceTrue : N/A"
+                                                 "\ntimeApproximate : N/A"
+                                                 "\ntimeTrue : N/A"
+                                                 "\n\nQuery : line 3"
+                                                 "\nError : Invalid Query"
+                                                 "\n\ntApproximateAverage : " + std::to_string(0.125) + " ms"
+                                                 "\ntApproximateTrue : " + std::to_string(3.0) + " ms"
+                                                 "\nMAF : +∞",
+
+                                                 "query,approximate_neighbor,approximate_distance,approximate_time_ms,true_neighbor,true_distance,true_time_ms,error\n"
+                                                 "\"query1\",\"item\"\"1\"\"\",2.5,0.125,\"item2\",1.25,3,\n"
+                                                 "\"query2\",,,,,,,\n"
+                                                 "\"line 3\",,,,,,,\"Invalid Query\"\n",
+
+                                                 "{\"type\":\"parameters\",\"Algorithm\":\"LSH_Vector\",\"L\":\"5\"}\n"
+                                                 "{\"type\":\"query\",\"query\":\"query1\",\"approximateNeighbor\":\"item\\\"1\\\"\",\"distanceApproximate\":2.5,\"timeApproximate\":0.125,"
+                                                 "\"trueNeighbor\":\"item2\",\"distanceTrue\":1.25,\"timeTrue\":3}\n"
+                                                 "{\"type\":\"query\",\"query\":\"query2\",\"approximateNeighbor\":null,\"distanceApproximate\":null,\"timeApproximate\":null,"
+                                                 "\"trueNeighbor\":null,\"distanceTrue\":null,\"timeTrue\":null}\n"
+                                                 "{\"type\":\"error\",\"query\":\"line 3\",\"error\":\"Invalid Query\"}\n"
+                                                 "{\"type\":\"summary\",\"tApproximateAverage\":0.125,\"tApproximateTrue\":3,\"MAF\":\"+inf\"}\n"};
+
+    std::vector<std::string> formats = {"text", "csv", "jsonl"};
+
+    for (unsigned int i = 0; i < formats.size(); ++i) {
+
+        ResultWriter *resultWriter = ResultWriter::createResultWriter(outputFilePath, formats[i]);
+        CU_ASSERT_FATAL(resultWriter != nullptr);
+
+        resultWriter->writeParameters(parameters);
+        resultWriter->writeResult("query1", &approximateID, 2.5, 0.125, &trueID, 1.25, 3.0);
+        resultWriter->writeResult("query2", nullptr, 0.0, 0.0, nullptr, 0.0, 0.0);
+        resultWriter->writeError("line 3", "Invalid Query");
+
+        /* Nothing is written to the file before the buffer is flushed */
+        CU_ASSERT(File::isFileEmpty(outputFilePath));
+
+        resultWriter->writeSummary(0.125, 3.0, true, std::numeric_limits<double>::max());
+        CU_ASSERT(resultWriter->flush());
+        delete resultWriter;
+
+        std::ifstream outputFile(outputFilePath);
+        std::string contents((std::istreambuf_iterator<char>(outputFile)), std::istreambuf_iterator<char>());
+        outputFile.close();
+
+        CU_ASSERT(contents == expectedContents[i]);
+
+        std::remove(outputFilePath.c_str());
+    }
+
+    /* The csv header is only written once in case of appending to a file */
+    ResultWriter *resultWriter = ResultWriter::createResultWriter(outputFilePath, "csv");
+    resultWriter->writeResult("query2", nullptr, 0.0, 0.0, nullptr, 0.0, 0.0);
+    delete resultWriter;
+
+    resultWriter = ResultWriter::createResultWriter(outputFilePath, "csv");
+    resultWriter->writeResult("query2", nullptr, 0.0, 0.0, nullptr, 0.0, 0.0);
+    delete resultWriter;
+
+    std::ifstream outputFile(outputFilePath);
+    std::string contents((std::istreambuf_iterator<char>(outputFile)), std::istreambuf_iterator<char>());
+    outputFile.close();
+
+    CU_ASSERT(contents == expectedContents[1].substr(0, expectedContents[1].find('\n') + 1) + "\"query2\",,,,,,,\n\"query2\",,,,,,,\n");
+
+    std::remove(outputFilePath.c_str());
+}
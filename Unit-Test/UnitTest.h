@@ -18,6 +18,20 @@ public:
     static void testCurve(void);
     static void testRandom(void);
     static void testString(void);
+    static void testDataset(void);
+    static void testDistanceKernels(void);
+    static void testBatchDistances(void);
+    static void testParallel(void);
+    static void testHypercube(void);
+    static void testVectorLSH(void);
+    static void testProjectionMatrix(void);
+    static void testKNearestNeighbors(void);
+    static void testIndexFile(void);
+    static void testParser(void);
+    static void testBinaryCurvesFile(void);
+    static void testQueryStream(void);
+    static void testGroundTruthCache(void);
+    static void testResultWriter(void);
 };
 
 
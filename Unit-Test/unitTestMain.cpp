@@ -72,6 +72,89 @@ int main(void) {
         return CU_get_error();
     }
 
+    addTestStatus = CU_add_test(suite, "Test-Dataset", UnitTest::testDataset);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Distance-Kernels", UnitTest::testDistanceKernels);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Batch-Distances", UnitTest::testBatchDistances);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Parallel", UnitTest::testParallel);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Hypercube", UnitTest::testHypercube);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Vector-LSH", UnitTest::testVectorLSH);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+    addTestStatus = CU_add_test(suite, "Test-Projection-Matrix", UnitTest::testProjectionMatrix);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-K-Nearest-Neighbors", UnitTest::testKNearestNeighbors);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Index-File", UnitTest::testIndexFile);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Parser", UnitTest::testParser);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Binary-Curves-File", UnitTest::testBinaryCurvesFile);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Query-Stream", UnitTest::testQueryStream);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Ground-Truth-Cache", UnitTest::testGroundTruthCache);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
+    addTestStatus = CU_add_test(suite, "Test-Result-Writer", UnitTest::testResultWriter);
+    if (addTestStatus == nullptr) {
+        CU_cleanup_registry();
+        return CU_get_error();
+    }
+
     /* Run tests */
     CU_ErrorCode runTestsStatus = CU_basic_run_tests();
     if (runTestsStatus != CUE_SUCCESS) {
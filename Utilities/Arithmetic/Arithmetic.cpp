@@ -5,3 +5,21 @@ long long int Arithmetic::mod(long long int x, long long int y) {
     return (x % y + y) % y;
 }
 
+/* Utility function to calculate the Hamming distance of 2 bit masks, i.e. the number of bits set in x XOR y */
+unsigned int Arithmetic::hammingDistance(uint64_t x, uint64_t y) {
+    return __builtin_popcountll(x ^ y);
+}
+
+/* Utility function to calculate n choose k as a floating point number, so that large values saturate instead of overflowing */
+double Arithmetic::binomialCoefficient(unsigned int n, unsigned int k) {
+
+    if (k > n)
+        return 0.0;
+
+    double result = 1.0;
+    for (unsigned int i = 1; i <= k; ++i)
+        result = result * (n - k + i) / i;
+
+    return result;
+}
+
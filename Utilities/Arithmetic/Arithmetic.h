@@ -2,11 +2,14 @@
 #define ARITHMETIC_H
 
 #include <vector>
+#include <cstdint>
 
 class Arithmetic {
 
 public:
     static long long int mod(long long int, long long int);
+    static unsigned int hammingDistance(uint64_t, uint64_t);
+    static double binomialCoefficient(unsigned int, unsigned int);
 };
 
 
@@ -0,0 +1,88 @@
+#ifndef BOUNDEDHEAP_H
+#define BOUNDEDHEAP_H
+
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include <limits>
+#include "../../Metric-Modules/Continuous-Frechet/include/types.hpp"
+
+/* Max-heap that keeps the (at most) capacity items with the smallest distances seen so far
+ * The root is the worst of the kept items, thus a candidate is rejected with a single comparison once the heap is full
+ * Items of equal distance are ordered by their insertion order, so the results do not depend on the heap's internal layout */
+
+template<typename T>
+class BoundedHeap {
+
+private:
+    typedef std::tuple<distance_t, unsigned long int, T> Entry;
+
+    unsigned int capacity;
+    unsigned long int totalPushes;
+    std::vector<Entry> entries;
+
+public:
+    explicit BoundedHeap(unsigned int capacity) {
+        this->capacity = capacity;
+        this->totalPushes = 0;
+        this->entries.reserve(capacity);
+    }
+
+    bool isFull() const {
+        return this->entries.size() >= this->capacity;
+    }
+
+    unsigned int getSize() const {
+        return this->entries.size();
+    }
+
+    /* The distance a candidate has to beat in order to be kept */
+    distance_t getWorstDistance() const {
+
+        if (!this->isFull() || this->entries.empty())
+            return std::numeric_limits<distance_t>::max();
+
+        return std::get<0>(this->entries.front());
+    }
+
+    /* Returns true if the item was kept */
+    bool push(T item, distance_t distance) {
+
+        if (this->capacity == 0)
+            return false;
+
+        Entry entry(distance, this->totalPushes++, item);
+
+        if (!this->isFull()) {
+            this->entries.push_back(entry);
+            std::push_heap(this->entries.begin(), this->entries.end());
+            return true;
+        }
+
+        if (entry < this->entries.front()) {
+            std::pop_heap(this->entries.begin(), this->entries.end());
+            this->entries.back() = entry;
+            std::push_heap(this->entries.begin(), this->entries.end());
+            return true;
+        }
+
+        return false;
+    }
+
+    /* Returns the kept items sorted in ascending order of their distances */
+    std::vector<std::pair<T, distance_t>> *toSortedVector() const {
+
+        std::vector<Entry> sortedEntries(this->entries);
+        std::sort_heap(sortedEntries.begin(), sortedEntries.end());
+
+        std::vector<std::pair<T, distance_t>> *sortedItems = new std::vector<std::pair<T, distance_t>>;
+        sortedItems->reserve(sortedEntries.size());
+        for (const Entry &entry: sortedEntries)
+            sortedItems->push_back(std::make_pair(std::get<2>(entry), std::get<0>(entry)));
+
+        return sortedItems;
+    }
+};
+
+
+#endif
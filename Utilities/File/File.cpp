@@ -1,4 +1,8 @@
 #include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "File.h"
 
 /* Utility function to check if a file can be opened */
@@ -31,3 +35,39 @@ bool File::isInWindowsFormat(const std::string &filePath) {
     return isInWindowsFormat;
     
 }
+
+/* Utility function to memory-map a file read-only, which returns nullptr if the file could not be opened, is empty or could not be mapped
+ * On success the size of the mapping is stored in the size argument and the mapping should be released through File::unmapFile */
+const char *File::mapFile(const std::string &filePath, uint64_t &size) {
+
+    size = 0;
+
+    int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor == -1)
+        return nullptr;
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) == -1 || fileStatus.st_size == 0) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+
+    void *data = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    /* The mapping remains valid after the file is closed */
+    close(fileDescriptor);
+
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    size = fileStatus.st_size;
+
+    return (const char *) data;
+}
+
+/* Utility function to release a mapping created by File::mapFile */
+void File::unmapFile(const char *data, uint64_t size) {
+
+    if (data != nullptr)
+        munmap((void *) data, size);
+}
@@ -3,6 +3,7 @@
 
 
 #include <string>
+#include <cstdint>
 
 class File {
 
@@ -10,6 +11,8 @@ public:
     static bool canOpenFile(const std::string &);
     static bool isFileEmpty(const std::string &);
     static bool isInWindowsFormat(const std::string &);
+    static const char *mapFile(const std::string &, uint64_t &);
+    static void unmapFile(const char *, uint64_t);
 };
 
 
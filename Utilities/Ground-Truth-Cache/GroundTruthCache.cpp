@@ -0,0 +1,147 @@
+#include "GroundTruthCache.h"
+#include "../Index-Writer/IndexWriter.h"
+#include "../Index-Reader/IndexReader.h"
+
+const uint32_t GroundTruthCache::KIND = 4;
+const uint64_t GroundTruthCache::FNV_OFFSET_BASIS = 14695981039346656037ull;
+const uint64_t GroundTruthCache::FNV_PRIME = 1099511628211ull;
+
+GroundTruthCache::GroundTruthCache(const std::string &filePath, uint64_t datasetHash) {
+
+    this->filePath = filePath;
+    this->datasetHash = datasetHash;
+    this->modified = false;
+}
+
+/* Utility function to continue the FNV-1a hash value of some bytes with the given ones */
+uint64_t GroundTruthCache::hash(const void *data, uint64_t size, uint64_t value) {
+
+    const unsigned char *bytes = (const unsigned char *) data;
+
+    for (uint64_t i = 0; i < size; ++i) {
+        value ^= bytes[i];
+        value *= GroundTruthCache::FNV_PRIME;
+    }
+
+    return value;
+}
+
+/* Utility function to continue the hash value with the dimensions, the complexity and the coordinates of a Curve */
+uint64_t GroundTruthCache::hash(const Curve &curve, uint64_t value) {
+
+    uint32_t dimensions = curve.getDimensions();
+    uint32_t complexity = curve.getComplexity();
+
+    value = GroundTruthCache::hash(&dimensions, sizeof(dimensions), value);
+    value = GroundTruthCache::hash(&complexity, sizeof(complexity), value);
+
+    for (unsigned int i = 0; i < complexity; ++i)
+        for (unsigned int j = 0; j < dimensions; ++j) {
+            coordinate_t coordinate = curve[i][j];
+            value = GroundTruthCache::hash(&coordinate, sizeof(coordinate), value);
+        }
+
+    return value;
+}
+
+/* Utility function to get the hash value of a Query Curve */
+uint64_t GroundTruthCache::hashCurve(const Curve &curve) {
+    return GroundTruthCache::hash(curve, GroundTruthCache::FNV_OFFSET_BASIS);
+}
+
+/* Utility function to create the GroundTruthCache of the given Input Curves and metric, whose entries are read from the given file
+ * The cache starts empty if the file does not exist, is not a valid cache file or was written for other Input Curves or another metric, in which case save overwrites it
+ * The ids of the Input Curves are part of the hash as they are what the cache stores */
+GroundTruthCache *GroundTruthCache::createGroundTruthCache(const std::string &filePath, const std::vector<Curve *> &inputCurves, const std::string &metric) {
+
+    uint64_t datasetHash = GroundTruthCache::hash(metric.data(), metric.size(), GroundTruthCache::FNV_OFFSET_BASIS);
+
+    for (const Curve *curve: inputCurves) {
+        datasetHash = GroundTruthCache::hash(curve->getID().data(), curve->getID().size(), datasetHash);
+        datasetHash = GroundTruthCache::hash(*curve, datasetHash);
+    }
+
+    GroundTruthCache *groundTruthCache = new GroundTruthCache(filePath, datasetHash);
+
+    IndexReader *indexReader = IndexReader::createIndexReader(filePath);
+
+    if (indexReader == nullptr || indexReader->getKind() != GroundTruthCache::KIND || indexReader->readValue<uint64_t>() != datasetHash) {
+        delete indexReader;
+        return groundTruthCache;
+    }
+
+    uint64_t totalEntries = indexReader->readValue<uint64_t>();
+
+    for (uint64_t i = 0; i < totalEntries && indexReader->isValid(); ++i) {
+        uint64_t queryHash = indexReader->readValue<uint64_t>();
+        std::string id = indexReader->readString();
+        distance_t distance = indexReader->readValue<distance_t>();
+        double duration = indexReader->readValue<double>();
+        groundTruthCache->entries[queryHash] = std::make_tuple(id, distance, duration);
+    }
+
+    /* A damaged cache is discarded as a whole */
+    if (!indexReader->isValid())
+        groundTruthCache->entries.clear();
+
+    delete indexReader;
+
+    return groundTruthCache;
+}
+
+unsigned int GroundTruthCache::getSize() const {
+    return this->entries.size();
+}
+
+/* Function to look up the exact nearest neighbor of the Query Curve with the given hash value, which returns false on a cache miss
+ * It does not modify the cache, thus it may be called concurrently */
+bool GroundTruthCache::find(uint64_t queryHash, std::tuple<std::string, distance_t, double> &exactNeighbor) const {
+
+    auto entry = this->entries.find(queryHash);
+
+    if (entry == this->entries.end())
+        return false;
+
+    exactNeighbor = entry->second;
+
+    return true;
+}
+
+void GroundTruthCache::insert(uint64_t queryHash, const std::tuple<std::string, distance_t, double> &exactNeighbor) {
+
+    if (this->entries.count(queryHash) != 0)
+        return;
+
+    this->entries[queryHash] = exactNeighbor;
+    this->modified = true;
+}
+
+/* Function to write the cache back to its file, in case any entry was inserted since it was read. It returns false if the file could not be written */
+bool GroundTruthCache::save() {
+
+    if (!this->modified)
+        return true;
+
+    IndexWriter *indexWriter = IndexWriter::createIndexWriter(this->filePath, GroundTruthCache::KIND);
+
+    if (indexWriter == nullptr)
+        return false;
+
+    indexWriter->writeValue<uint64_t>(this->datasetHash);
+    indexWriter->writeValue<uint64_t>(this->entries.size());
+
+    for (const auto &entry: this->entries) {
+        indexWriter->writeValue<uint64_t>(entry.first);
+        indexWriter->writeString(std::get<0>(entry.second));
+        indexWriter->writeValue<distance_t>(std::get<1>(entry.second));
+        indexWriter->writeValue<double>(std::get<2>(entry.second));
+    }
+
+    bool isValid = indexWriter->isValid();
+    delete indexWriter;
+
+    if (isValid)
+        this->modified = false;
+
+    return isValid;
+}
@@ -0,0 +1,40 @@
+#ifndef GROUNDTRUTHCACHE_H
+#define GROUNDTRUTHCACHE_H
+
+#include <string>
+#include <tuple>
+#include <cstdint>
+#include <unordered_map>
+#include "../../Curve-Modules/Curve/Curve.h"
+
+/* Class that caches the exact nearest neighbor - id, distance and duration of the brute force search - of each Query Curve in an index file
+ * The cache is keyed by a hash of the Input Curves and the metric, and within it by a hash of each Query Curve, thus it is only reused for the same Input Curves and metric
+ * Hashes are 64-bit FNV-1a hashes of the coordinates, thus Query Curves that only differ in their ids share the same entry */
+class GroundTruthCache {
+
+private:
+    static const uint32_t KIND;
+    static const uint64_t FNV_OFFSET_BASIS;
+    static const uint64_t FNV_PRIME;
+
+    std::string filePath;
+    uint64_t datasetHash;
+    bool modified;
+    std::unordered_map<uint64_t, std::tuple<std::string, distance_t, double>> entries;
+
+    GroundTruthCache(const std::string &, uint64_t);
+    static uint64_t hash(const void *, uint64_t, uint64_t);
+    static uint64_t hash(const Curve &, uint64_t);
+
+public:
+    static GroundTruthCache *createGroundTruthCache(const std::string &, const std::vector<Curve *> &, const std::string &);
+    static uint64_t hashCurve(const Curve &);
+
+    unsigned int getSize() const;
+    bool find(uint64_t, std::tuple<std::string, distance_t, double> &) const;
+    void insert(uint64_t, const std::tuple<std::string, distance_t, double> &);
+    bool save();
+};
+
+
+#endif
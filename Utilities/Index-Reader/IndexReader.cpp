@@ -0,0 +1,85 @@
+#include <cstring>
+#include "IndexReader.h"
+#include "../Index-Writer/IndexWriter.h"
+#include "../File/File.h"
+#include "../../Metric-Modules/Continuous-Frechet/include/types.hpp"
+
+IndexReader::IndexReader(const char *data, uint64_t size) {
+
+    this->data = data;
+    this->size = size;
+    this->offset = 0;
+    this->valid = true;
+    this->kind = 0;
+}
+
+/* Utility function to memory-map the given index file and read its header
+ * It returns nullptr if the file could not be mapped, or if it was not written by IndexWriter with the current format version and coordinate types */
+IndexReader *IndexReader::createIndexReader(const std::string &filePath) {
+
+    uint64_t size;
+    const char *data = File::mapFile(filePath, size);
+    if (data == nullptr)
+        return nullptr;
+
+    IndexReader *indexReader = new IndexReader(data, size);
+
+    char magic[sizeof(IndexWriter::MAGIC)];
+    indexReader->read(magic, sizeof(magic));
+    uint32_t version = indexReader->readValue<uint32_t>();
+    indexReader->kind = indexReader->readValue<uint32_t>();
+    uint32_t coordinateSize = indexReader->readValue<uint32_t>();
+    uint32_t distanceSize = indexReader->readValue<uint32_t>();
+
+    if (!indexReader->isValid() || std::memcmp(magic, IndexWriter::MAGIC, sizeof(magic)) != 0 || version != IndexWriter::VERSION || coordinateSize != sizeof(coordinate_t) || distanceSize != sizeof(distance_t)) {
+        delete indexReader;
+        return nullptr;
+    }
+
+    return indexReader;
+}
+
+IndexReader::~IndexReader() {
+    File::unmapFile(this->data, this->size);
+}
+
+bool IndexReader::isValid() const {
+    return this->valid;
+}
+
+/* Function to mark the IndexReader as invalid, in case a value that was read is inconsistent with the rest of the index */
+void IndexReader::invalidate() {
+    this->valid = false;
+}
+
+uint32_t IndexReader::getKind() const {
+    return this->kind;
+}
+
+/* Function to check if at least the given number of bytes is left to be read, otherwise the IndexReader is marked as invalid */
+bool IndexReader::hasRemaining(uint64_t bytes) {
+
+    if (!this->valid || bytes > this->size - this->offset)
+        this->valid = false;
+
+    return this->valid;
+}
+
+void IndexReader::read(void *values, uint64_t bytes) {
+
+    if (!this->hasRemaining(bytes)) {
+        std::memset(values, 0, bytes);
+        return;
+    }
+
+    std::memcpy(values, this->data + this->offset, bytes);
+    this->offset += bytes;
+}
+
+std::string IndexReader::readString() {
+
+    std::vector<char> characters;
+    this->readArray(characters);
+
+    return std::string(characters.begin(), characters.end());
+}
@@ -0,0 +1,80 @@
+#ifndef INDEXREADER_H
+#define INDEXREADER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+/* Class that reads an index file written by IndexWriter
+ * The whole file is memory-mapped read-only and the values are copied out of the mapping in the order they were written, thus no parsing takes place
+ * Reading past the end of the file marks the IndexReader as invalid and yields zeros, so a corrupted index file is detected by checking IndexReader::isValid once at the end */
+
+class IndexReader {
+
+private:
+    const char *data;
+    uint64_t size;
+    uint64_t offset;
+    bool valid;
+    uint32_t kind;
+
+    IndexReader(const char *, uint64_t);
+
+public:
+    static IndexReader *createIndexReader(const std::string &);
+    ~IndexReader();
+
+    bool isValid() const;
+    void invalidate();
+    uint32_t getKind() const;
+    bool hasRemaining(uint64_t);
+    void read(void *, uint64_t);
+    std::string readString();
+
+    template<typename T>
+    T readValue() {
+        T value = T();
+        this->read(&value, sizeof(T));
+        return value;
+    }
+
+    /* Function to check whether the given number of values of type T remain to be read, which is done by a division as the number of bytes could overflow for a corrupted number */
+    template<typename T>
+    bool hasRemainingValues(uint64_t size) {
+
+        if (size > (this->size - this->offset) / sizeof(T))
+            this->valid = false;
+
+        return this->valid;
+    }
+
+    /* Function to read an array of exactly the given size into values */
+    template<typename T>
+    void readArray(T *values, uint64_t size) {
+
+        if (this->readValue<uint64_t>() != size || !this->hasRemainingValues<T>(size)) {
+            this->valid = false;
+            std::fill(values, values + size, T());
+            return;
+        }
+
+        this->read(values, size * sizeof(T));
+    }
+
+    template<typename T>
+    void readArray(std::vector<T> &values) {
+
+        uint64_t size = this->readValue<uint64_t>();
+
+        /* The size is checked before the allocation, so that a corrupted size does not lead to a huge one */
+        if (!this->hasRemainingValues<T>(size))
+            size = 0;
+
+        values.resize(size);
+        this->read(values.data(), size * sizeof(T));
+    }
+};
+
+
+#endif
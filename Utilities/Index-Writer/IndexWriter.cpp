@@ -0,0 +1,41 @@
+#include "IndexWriter.h"
+#include "../../Metric-Modules/Continuous-Frechet/include/types.hpp"
+
+const char IndexWriter::MAGIC[8] = {'C', 'U', 'R', 'V', 'E', 'A', 'N', 'N'};
+const uint32_t IndexWriter::VERSION = 1;
+
+IndexWriter::IndexWriter(const std::string &filePath) {
+    this->file.open(filePath, std::ios::binary | std::ios::trunc);
+}
+
+/* Utility function to create an index file of the given kind and write its header, which returns nullptr if the file could not be created */
+IndexWriter *IndexWriter::createIndexWriter(const std::string &filePath, uint32_t kind) {
+
+    IndexWriter *indexWriter = new IndexWriter(filePath);
+
+    if (!indexWriter->isValid()) {
+        delete indexWriter;
+        return nullptr;
+    }
+
+    indexWriter->write(IndexWriter::MAGIC, sizeof(IndexWriter::MAGIC));
+    indexWriter->writeValue<uint32_t>(IndexWriter::VERSION);
+    indexWriter->writeValue<uint32_t>(kind);
+    indexWriter->writeValue<uint32_t>(sizeof(coordinate_t));
+    indexWriter->writeValue<uint32_t>(sizeof(distance_t));
+
+    return indexWriter;
+}
+
+/* Function to check if every value so far was written successfully */
+bool IndexWriter::isValid() const {
+    return this->file.good();
+}
+
+void IndexWriter::write(const void *values, uint64_t size) {
+    this->file.write((const char *) values, size);
+}
+
+void IndexWriter::writeString(const std::string &string) {
+    this->writeArray(string.data(), string.size());
+}
@@ -0,0 +1,49 @@
+#ifndef INDEXWRITER_H
+#define INDEXWRITER_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+
+/* Class that writes a binary index file, which is read back by IndexReader
+ * An index file starts with a header - magic number, format version, kind of index and size of a coordinate - followed by the raw values written by the index's classes
+ * Values are written in the machine's native byte order, thus an index file should be read on the machine - or kind of machine - that wrote it */
+
+class IndexWriter {
+
+private:
+    std::ofstream file;
+
+    explicit IndexWriter(const std::string &);
+
+public:
+    static const char MAGIC[8];
+    static const uint32_t VERSION;
+
+    static IndexWriter *createIndexWriter(const std::string &, uint32_t);
+
+    bool isValid() const;
+    void write(const void *, uint64_t);
+    void writeString(const std::string &);
+
+    template<typename T>
+    void writeValue(const T &value) {
+        this->write(&value, sizeof(T));
+    }
+
+    /* Arrays are written as their size followed by their values */
+    template<typename T>
+    void writeArray(const T *values, uint64_t size) {
+        this->writeValue<uint64_t>(size);
+        this->write(values, size * sizeof(T));
+    }
+
+    template<typename T>
+    void writeArray(const std::vector<T> &values) {
+        this->writeArray(values.data(), values.size());
+    }
+};
+
+
+#endif
@@ -0,0 +1,119 @@
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include "Parallel.h"
+
+/* Whether the current thread is executing the tasks of a Parallel::parallelFor that uses more than one thread */
+thread_local bool Parallel::insideParallelFor = false;
+
+/* Utility function to decide whether the current thread is one of the threads of a Parallel::parallelFor, in which case the hardware threads are already in use
+ * Code that could itself run in parallel e.g. the OpenMP loops of the Continuous Frechet distance should then run serially */
+bool Parallel::isInsideParallelFor() {
+    return Parallel::insideParallelFor;
+}
+
+/* Utility function to get the number of hardware threads, or 1 if it can't be determined */
+unsigned int Parallel::getHardwareThreads() {
+
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+
+    if (hardwareThreads == 0)
+        return 1;
+
+    return hardwareThreads;
+}
+
+/* Utility function to execute task(0), task(1), ... , task(totalTasks - 1) using at most totalThreads threads
+ * The tasks are handed out one at a time through a shared counter, thus a thread that gets cheap tasks simply executes more of them
+ * Each task should only write to state that no other task touches */
+void Parallel::parallelFor(unsigned int totalTasks, unsigned int totalThreads, const std::function<void(unsigned int)> &task) {
+
+    if (totalThreads > totalTasks)
+        totalThreads = totalTasks;
+
+    /* No threads are spawned in the serial case */
+    if (totalThreads <= 1) {
+        for (unsigned int i = 0; i < totalTasks; ++i)
+            task(i);
+        return;
+    }
+
+    std::atomic<unsigned int> nextTask(0);
+
+    auto worker = [&]() {
+
+        bool wasInsideParallelFor = Parallel::insideParallelFor;
+        Parallel::insideParallelFor = true;
+
+        for (unsigned int i = nextTask++; i < totalTasks; i = nextTask++)
+            task(i);
+
+        Parallel::insideParallelFor = wasInsideParallelFor;
+    };
+
+    /* The calling thread acts as one of the workers */
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < totalThreads; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread: threads)
+        thread.join();
+}
+
+/* Utility function to split the tasks 0, 1, ... , totalTasks - 1 into blocks of (at most) blockSize consecutive tasks and execute task(first, last) for each block [first, last)
+ * It should be preferred over Parallel::parallelFor when the individual tasks are too cheap to be handed out one at a time */
+void Parallel::parallelForBlocks(unsigned int totalTasks, unsigned int blockSize, unsigned int totalThreads, const std::function<void(unsigned int, unsigned int)> &task) {
+
+    if (blockSize == 0)
+        blockSize = 1;
+
+    unsigned int totalBlocks = totalTasks / blockSize + (totalTasks % blockSize != 0);
+
+    Parallel::parallelFor(totalBlocks, totalThreads, [&](unsigned int block) {
+        unsigned int first = block * blockSize;
+        task(first, first + std::min(blockSize, totalTasks - first));
+    });
+}
+
+/* Utility function to perform a stable counting sort of the given keys - each one in [0, totalKeys) - using at most totalThreads threads
+ * On return the positions of the keys equal to X are order[offsets[X]], order[offsets[X] + 1], ... , order[offsets[X + 1] - 1] in ascending order
+ * The keys are split in at most one chunk per thread, each chunk is counted and scattered independently and the chunks' counts are combined in between */
+void Parallel::countingSort(const std::vector<unsigned int> &keys, unsigned int totalKeys, unsigned int totalThreads, std::vector<unsigned int> &offsets, std::vector<unsigned int> &order) {
+
+    /* Each chunk keeps a counter per key, thus the chunks are limited so that their counters are at most as many as the keys themselves
+     * e.g. a hash table with a bucket per 8 Points is sorted by at most 8 chunks, regardless of the number of threads */
+    unsigned int totalChunks = std::max(1u, std::min(totalThreads, (unsigned int) (keys.size() / std::max(1u, totalKeys))));
+    unsigned int chunkSize = keys.size() / totalChunks + (keys.size() % totalChunks != 0);
+
+    /* Count the keys of each chunk */
+    std::vector<std::vector<unsigned int>> counts(totalChunks, std::vector<unsigned int>(totalKeys, 0));
+    Parallel::parallelFor(totalChunks, totalThreads, [&](unsigned int chunk) {
+        for (unsigned int i = chunk * chunkSize; i < keys.size() && i < (chunk + 1) * chunkSize; ++i)
+            counts[chunk][keys[i]]++;
+    });
+
+    /* Replace each count with the position of the chunk's first key equal to X, so that the chunks are placed in order within X's range */
+    offsets.assign(totalKeys + 1, 0);
+    unsigned int position = 0;
+    for (unsigned int key = 0; key < totalKeys; ++key) {
+
+        offsets[key] = position;
+
+        for (unsigned int chunk = 0; chunk < totalChunks; ++chunk) {
+            unsigned int count = counts[chunk][key];
+            counts[chunk][key] = position;
+            position += count;
+        }
+    }
+    offsets[totalKeys] = position;
+
+    /* Scatter the positions of the keys of each chunk */
+    order.resize(keys.size());
+    Parallel::parallelFor(totalChunks, totalThreads, [&](unsigned int chunk) {
+        for (unsigned int i = chunk * chunkSize; i < keys.size() && i < (chunk + 1) * chunkSize; ++i)
+            order[counts[chunk][keys[i]]++] = i;
+    });
+}
@@ -0,0 +1,23 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <functional>
+#include <vector>
+
+/* Static class that distributes independent tasks among a pool of worker threads */
+
+class Parallel {
+
+private:
+    static thread_local bool insideParallelFor;
+
+public:
+    static unsigned int getHardwareThreads();
+    static bool isInsideParallelFor();
+    static void parallelFor(unsigned int, unsigned int, const std::function<void(unsigned int)> &);
+    static void parallelForBlocks(unsigned int, unsigned int, unsigned int, const std::function<void(unsigned int, unsigned int)> &);
+    static void countingSort(const std::vector<unsigned int> &, unsigned int, unsigned int, std::vector<unsigned int> &, std::vector<unsigned int> &);
+};
+
+
+#endif
@@ -1,79 +1,404 @@
+#include <cstring>
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include "Parser.h"
+#include "../File/File.h"
 #include "../String/String.h"
+#include "../Parallel/Parallel.h"
 
-/* Utility function to parse any file in Linux format that contains Curves in the following format : [curve_id y_1 y_2 ... y_n] */
-std::vector<Curve *> *Parser::parseCurvesFile(const std::string &filePath, unsigned int dimensions, long double frequency, unsigned int complexity)
+/* Files smaller than this are not worth splitting among threads */
+const uint64_t Parser::MIN_CHUNK_SIZE = 1 << 20;
+
+const char Parser::BINARY_MAGIC[8] = {'C', 'U', 'R', 'V', 'E', 'B', 'I', 'N'};
+const uint32_t Parser::BINARY_VERSION = 1;
+const uint64_t Parser::BINARY_HEADER_SIZE = sizeof(Parser::BINARY_MAGIC) + 4 * sizeof(uint32_t) + sizeof(uint64_t);
+
+/* Utility function to find the end of the line that starts at begin, which is either the position of its '\n' or the end of the file */
+const char *Parser::findLineEnd(const char *begin, const char *end) {
+
+    const char *lineEnd = static_cast<const char *>(std::memchr(begin, '\n', end - begin));
+
+    if (lineEnd == nullptr)
+        return end;
+
+    return lineEnd;
+}
+
+/* Utility function to scan the line [begin, end) in place, which is split on '\t' exactly like String::tokenizeString would split it
+ * It returns true if the line has the format [curve_id y_1 y_2 ... y_n] and either n == complexity, or complexity is 0 and n >= 2
+ * In that case idEnd points right after the curve_id token and values holds y_1, y_2, ... , y_n */
+bool Parser::parseLine(const char *begin, const char *end, unsigned int complexity, const char *&idEnd, std::vector<coordinate_t> &values) {
+
+    values.clear();
+
+    /* std::getline does not produce an empty last token */
+    if (begin != end && end[-1] == '\t')
+        end--;
+
+    idEnd = static_cast<const char *>(std::memchr(begin, '\t', end - begin));
+
+    if (idEnd == nullptr)
+        return false;
+
+    const char *token = idEnd + 1;
+
+    while (true) {
+
+        const char *tokenEnd = static_cast<const char *>(std::memchr(token, '\t', end - token));
+        if (tokenEnd == nullptr)
+            tokenEnd = end;
+
+        long double value;
+
+        if (!String::parseFloatingPointNumber(token, tokenEnd, value) || (complexity != 0 && values.size() == complexity))
+            return false;
+
+        values.push_back((coordinate_t) value);
+
+        if (tokenEnd == end)
+            break;
+
+        token = tokenEnd + 1;
+    }
+
+    /* The provided Continuous-Frechet-Distance library works only for Curves with complexity of at least 2 */
+    return values.size() >= 2 && (complexity == 0 || values.size() == complexity);
+}
+
+/* Utility function to create a dimensions-dimensional Curve given its id and its y values, where coordinates is a buffer of dimensions coordinate_t values */
+Curve *Parser::createCurve(const std::string &id, const std::vector<coordinate_t> &values, unsigned int dimensions, coordinate_t frequency, std::vector<coordinate_t> &coordinates) {
+
+    Curve *curve = Curve::createCurve(id, dimensions);
+
+    coordinate_t xCoordinate = 0.0;
+
+    for (coordinate_t value: values) {
+
+        /* Create and insert an 1/2-dimensional Vector */
+        if (dimensions == 2) {
+            coordinates[0] = xCoordinate;
+            coordinates[1] = value;
+            xCoordinate += frequency;
+        }
+        else
+            coordinates[0] = value;
+
+        curve->insert(new Vector(coordinates));
+    }
+
+    return curve;
+}
+
+/* Utility function to parse the lines in [begin, end), which should start at a line boundary, and append the valid Curves of the given complexity to curves */
+void Parser::parseLines(const char *begin, const char *end, unsigned int dimensions, coordinate_t frequency, unsigned int complexity, std::vector<Curve *> &curves) {
+
+    std::vector<coordinate_t> values;
+    values.reserve(complexity);
+
+    std::vector<coordinate_t> coordinates(dimensions);
+
+    while (begin < end) {
+
+        const char *lineEnd = Parser::findLineEnd(begin, end);
+        const char *idEnd;
+
+        if (Parser::parseLine(begin, lineEnd, complexity, idEnd, values))
+            curves.push_back(Parser::createCurve(std::string(begin, idEnd), values, dimensions, frequency, coordinates));
+
+        begin = lineEnd + (lineEnd != end);
+    }
+}
+
+/* Utility function to parse a single line - without its '\n' - in the format [curve_id y_1 y_2 ... y_n], which returns nullptr if the line is not a valid Curve
+ * If complexity is not 0 then only a Curve of that complexity is valid */
+Curve *Parser::parseCurve(const std::string &line, unsigned int dimensions, coordinate_t frequency, unsigned int complexity) {
+
+    if (dimensions == 0 || dimensions > 2)
+        return nullptr;
+
+    std::vector<coordinate_t> values;
+    std::vector<coordinate_t> coordinates(dimensions);
+    const char *idEnd;
+
+    if (!Parser::parseLine(line.data(), line.data() + line.size(), complexity, idEnd, values))
+        return nullptr;
+
+    return Parser::createCurve(std::string(line.data(), idEnd), values, dimensions, frequency, coordinates);
+}
+
+/* Utility function to parse any file in Linux format that contains Curves in the following format : [curve_id y_1 y_2 ... y_n], or any binary Curves file
+ * The file is memory-mapped and scanned in place, and if more than 1 thread is provided it is split at line boundaries into chunks that are parsed concurrently
+ * The Curves are returned in the order they appear in the file */
+std::vector<Curve *> *Parser::parseCurvesFile(const std::string &filePath, unsigned int dimensions, coordinate_t frequency, unsigned int complexity, unsigned int threads)
 {
 
     /* Will only parse Curves as 1-dimensional or 2-dimensional */
     if (dimensions == 0 || dimensions > 2)
         return nullptr;
 
-    std::ifstream file;
-    file.open(filePath);
-
     std::vector<Curve *> *inputCurves = new std::vector<Curve *>;
 
-    std::string line;
+    uint64_t size;
+    const char *data = File::mapFile(filePath, size);
 
-    /* Read each line of the file */
-    while (std::getline(file, line)) {
+    if (data == nullptr)
+        return inputCurves;
 
-        bool areTokensValid = true;
+    if (Parser::isBinaryCurvesFile(data, size)) {
+        Parser::parseBinaryCurves(data, size, dimensions, frequency, complexity, threads, *inputCurves);
+        File::unmapFile(data, size);
+        return inputCurves;
+    }
 
-        /* Tokenize the line read */
-        std::vector<std::string> *curveTokens = String::tokenizeString(line, '\t');
+    const char *begin = data;
+    const char *end = data + size;
 
-        /* Check if the line read has at least 3 tokens due to the fact that the provided Continuous-Frechet-Distance library works only for Curves with complexity of at least 2 */
-        if (curveTokens->size() <= 2)
-            areTokensValid = false;
+    /* If no complexity was provided then ONLY Curves with complexity X be parsed where X is the complexity of the first valid format-wise Curve
+     * Thus X is determined before the file is split and every line before the first valid Curve is skipped */
+    if (complexity == 0) {
 
-        /* Check if each token besides the curve_id one is a floating point number */
-        if (areTokensValid)
-            for (long unsigned int i = 1; i < curveTokens->size(); ++i)
-                if (!String::isFloatingPointNumber(curveTokens->at(i))) {
-                    areTokensValid = false;
-                    break;
-                }
+        std::vector<coordinate_t> values;
 
-        /* If no complexity was provided then ONLY Curves with complexity X be parsed where X is the complexity of the first valid format-wise Curve */
-        if (areTokensValid && complexity == 0)
-            complexity = curveTokens->size() - 1;
+        while (begin < end) {
 
+            const char *lineEnd = Parser::findLineEnd(begin, end);
+            const char *idEnd;
 
-        if (areTokensValid && curveTokens->size() - 1 == complexity) {
+            if (Parser::parseLine(begin, lineEnd, 0, idEnd, values)) {
+                complexity = values.size();
+                break;
+            }
 
-            /* Create a dimensions-dimensional Curve */
-            Curve *curve = Curve::createCurve(curveTokens->at(0), dimensions);
+            begin = lineEnd + (lineEnd != end);
+        }
 
-            long double xCoordinate = 0.0;
+        if (complexity == 0) {
+            File::unmapFile(data, size);
+            return inputCurves;
+        }
+    }
 
-            for (unsigned int i = 1; i < curveTokens->size(); ++i) {
+    /* Split the rest of the file in a few chunks per thread, each of which ends right after a '\n' */
+    uint64_t remainingSize = end - begin;
+    uint64_t totalChunks = 1;
 
-                /* Create and insert an 1/2-dimensional Vector */
-                std::vector<long double> coordinates;
+    if (threads > 1 && remainingSize > Parser::MIN_CHUNK_SIZE)
+        totalChunks = std::min((uint64_t) threads * 4, remainingSize / Parser::MIN_CHUNK_SIZE);
 
-                if (dimensions == 2) {
-                    coordinates.push_back(xCoordinate);
-                    xCoordinate += frequency;
-                }
+    std::vector<const char *> boundaries(totalChunks + 1, end);
+    boundaries[0] = begin;
 
-                coordinates.push_back(std::stold(curveTokens->at(i)));
-                curve->insert(new Vector(coordinates));
+    for (uint64_t i = 1; i < totalChunks; ++i) {
 
-            }
+        const char *boundary = begin + i * (remainingSize / totalChunks);
 
-            inputCurves->push_back(curve);
-        }
+        if (boundary < boundaries[i - 1])
+            boundary = boundaries[i - 1];
 
-        delete curveTokens;
+        const char *lineEnd = Parser::findLineEnd(boundary, end);
+        boundaries[i] = lineEnd + (lineEnd != end);
     }
 
-    file.close();
+    std::vector<std::vector<Curve *>> chunkCurves(totalChunks);
 
+    Parallel::parallelFor((unsigned int) totalChunks, threads, [&](unsigned int chunk) {
+        Parser::parseLines(boundaries[chunk], boundaries[chunk + 1], dimensions, frequency, complexity, chunkCurves[chunk]);
+    });
+
+    File::unmapFile(data, size);
+
+    for (const std::vector<Curve *> &curves: chunkCurves)
+        inputCurves->insert(inputCurves->end(), curves.begin(), curves.end());
 
     return inputCurves;
 }
 
+/* Utility function to check if the given data start with the magic of a binary Curves file */
+bool Parser::isBinaryCurvesFile(const char *data, uint64_t size) {
+    return size >= Parser::BINARY_HEADER_SIZE && std::memcmp(data, Parser::BINARY_MAGIC, sizeof(Parser::BINARY_MAGIC)) == 0;
+}
+
+/* Utility function to check if a file is a binary Curves file, in which case it should not be checked for its new line character set */
+bool Parser::isBinaryCurvesFile(const std::string &filePath) {
 
+    char magic[sizeof(Parser::BINARY_MAGIC)];
+
+    std::ifstream file(filePath, std::ios::binary);
+    file.read(magic, sizeof(magic));
+
+    return file.gcount() == sizeof(magic) && std::memcmp(magic, Parser::BINARY_MAGIC, sizeof(magic)) == 0;
+}
+
+/* Utility function to create the Curves of a memory-mapped binary Curves file
+ * Curves stored as 1-dimensional may be parsed as 2-dimensional, in which case the x coordinates are 0, frequency, 2 * frequency, ... exactly like in text files
+ * No Curve is created if the file is malformed, if it stores 2-dimensional Curves and 1-dimensional ones were requested or if a complexity other than the stored one was requested */
+void Parser::parseBinaryCurves(const char *data, uint64_t size, unsigned int dimensions, coordinate_t frequency, unsigned int complexity, unsigned int threads, std::vector<Curve *> &curves) {
+
+    uint32_t header[4];
+    uint64_t totalCurves;
+    std::memcpy(header, data + sizeof(Parser::BINARY_MAGIC), sizeof(header));
+    std::memcpy(&totalCurves, data + sizeof(Parser::BINARY_MAGIC) + sizeof(header), sizeof(totalCurves));
+
+    uint32_t version = header[0];
+    uint32_t coordinateSize = header[1];
+    uint32_t storedDimensions = header[2];
+    uint32_t storedComplexity = header[3];
+
+    if (version != Parser::BINARY_VERSION || (coordinateSize != sizeof(float) && coordinateSize != sizeof(double)))
+        return;
+
+    if ((storedDimensions != 1 && storedDimensions != 2) || storedDimensions > dimensions || storedComplexity < 2)
+        return;
+
+    if (complexity != 0 && complexity != storedComplexity)
+        return;
+
+    /* Check that every section lies within the file before anything is read */
+    uint64_t remainingSize = size - Parser::BINARY_HEADER_SIZE;
+
+    if (totalCurves >= remainingSize / sizeof(uint64_t) || totalCurves > std::numeric_limits<unsigned int>::max())
+        return;
+
+    const char *idOffsets = data + Parser::BINARY_HEADER_SIZE;
+    const char *ids = idOffsets + (totalCurves + 1) * sizeof(uint64_t);
+    remainingSize -= (totalCurves + 1) * sizeof(uint64_t);
+
+    uint64_t idsSize;
+    std::memcpy(&idsSize, idOffsets + totalCurves * sizeof(uint64_t), sizeof(idsSize));
+
+    if (idsSize > remainingSize)
+        return;
+
+    uint64_t coordinatesOffset = (ids - data) + idsSize;
+    coordinatesOffset += (8 - coordinatesOffset % 8) % 8;
+
+    uint64_t valuesPerCurve = (uint64_t) storedComplexity * storedDimensions;
+
+    if (coordinatesOffset > size || (size - coordinatesOffset) / coordinateSize / valuesPerCurve < totalCurves)
+        return;
+
+    const char *coordinates = data + coordinatesOffset;
+
+    /* The id offsets should be non-decreasing */
+    std::vector<uint64_t> offsets(totalCurves + 1);
+    std::memcpy(offsets.data(), idOffsets, offsets.size() * sizeof(uint64_t));
+
+    for (uint64_t i = 0; i < totalCurves; ++i)
+        if (offsets[i] > offsets[i + 1])
+            return;
+
+    curves.resize(totalCurves);
+
+    Parallel::parallelForBlocks((unsigned int) totalCurves, 1024, threads, [&](unsigned int first, unsigned int last) {
+
+        std::vector<coordinate_t> point(dimensions);
+
+        for (unsigned int i = first; i < last; ++i) {
+
+            Curve *curve = Curve::createCurve(std::string(ids + offsets[i], offsets[i + 1] - offsets[i]), dimensions);
+
+            const char *values = coordinates + i * valuesPerCurve * coordinateSize;
+            coordinate_t xCoordinate = 0.0;
+
+            for (uint64_t j = 0; j < valuesPerCurve; j += storedDimensions) {
+
+                for (unsigned int d = 0; d < storedDimensions; ++d) {
+
+                    if (coordinateSize == sizeof(float)) {
+                        float value;
+                        std::memcpy(&value, values + (j + d) * coordinateSize, sizeof(value));
+                        point[dimensions - storedDimensions + d] = (coordinate_t) value;
+                    }
+                    else {
+                        double value;
+                        std::memcpy(&value, values + (j + d) * coordinateSize, sizeof(value));
+                        point[dimensions - storedDimensions + d] = (coordinate_t) value;
+                    }
+                }
+
+                /* Time-series stored as 1-dimensional Curves get their x coordinates here */
+                if (storedDimensions < dimensions) {
+                    point[0] = xCoordinate;
+                    xCoordinate += frequency;
+                }
+
+                curve->insert(new Vector(point));
+            }
+
+            curves[i] = curve;
+        }
+    });
+}
+
+/* Utility function to write the given Curves, which should all have the same dimensions and complexity, to a binary Curves file
+ * The coordinates are stored either as float or as double depending on coordinateSize, which should be 4 or 8 respectively
+ * It returns false if the Curves could not have been written */
+bool Parser::writeBinaryCurvesFile(const std::string &filePath, const std::vector<Curve *> &curves, uint32_t coordinateSize) {
+
+    if (curves.empty() || (coordinateSize != sizeof(float) && coordinateSize != sizeof(double)))
+        return false;
+
+    uint32_t dimensions = curves[0]->getDimensions();
+    uint32_t complexity = curves[0]->getComplexity();
+
+    for (const Curve *curve: curves)
+        if (curve->getDimensions() != dimensions || curve->getComplexity() != complexity)
+            return false;
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+        return false;
+
+    uint64_t totalCurves = curves.size();
+    uint32_t header[4] = {Parser::BINARY_VERSION, coordinateSize, dimensions, complexity};
+
+    file.write(Parser::BINARY_MAGIC, sizeof(Parser::BINARY_MAGIC));
+    file.write((const char *) header, sizeof(header));
+    file.write((const char *) &totalCurves, sizeof(totalCurves));
+
+    /* The id string table */
+    std::vector<uint64_t> idOffsets(totalCurves + 1, 0);
+
+    for (uint64_t i = 0; i < totalCurves; ++i)
+        idOffsets[i + 1] = idOffsets[i] + curves[i]->getID().size();
+
+    file.write((const char *) idOffsets.data(), idOffsets.size() * sizeof(uint64_t));
+
+    for (const Curve *curve: curves)
+        file.write(curve->getID().data(), curve->getID().size());
+
+    uint64_t padding = (8 - (Parser::BINARY_HEADER_SIZE + idOffsets.size() * sizeof(uint64_t) + idOffsets[totalCurves]) % 8) % 8;
+    const char zeros[8] = {0};
+    file.write(zeros, padding);
+
+    /* The packed coordinates, one Curve at a time */
+    std::vector<char> buffer((uint64_t) complexity * dimensions * coordinateSize);
+
+    for (const Curve *curve: curves) {
+
+        char *position = buffer.data();
+
+        for (unsigned int i = 0; i < complexity; ++i)
+            for (unsigned int d = 0; d < dimensions; ++d) {
+
+                if (coordinateSize == sizeof(float)) {
+                    float value = (float) (*curve)[i][d];
+                    std::memcpy(position, &value, sizeof(value));
+                }
+                else {
+                    double value = (double) (*curve)[i][d];
+                    std::memcpy(position, &value, sizeof(value));
+                }
+
+                position += coordinateSize;
+            }
+
+        file.write(buffer.data(), buffer.size());
+    }
+
+    file.close();
+
+    return !file.fail();
+}
@@ -1,12 +1,34 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <cstdint>
 #include "../../Curve-Modules/Curve/Curve.h"
 
+/* Static class that reads Curves either from a text file in the format [curve_id y_1 y_2 ... y_n] or from the binary format written by Parser::writeBinaryCurvesFile
+ * Binary Curves files have the following layout, where every value is stored in the native byte order :
+ * [magic : 8 bytes][version : uint32][coordinate size : uint32][dimensions : uint32][complexity : uint32][total Curves : uint64]
+ * [id offsets : (total Curves + 1) * uint64][ids : id offsets[total Curves] bytes][padding to a multiple of 8 bytes]
+ * [coordinates : total Curves * complexity * dimensions values of coordinate size bytes each] */
 class Parser {
 
+private:
+    static const uint64_t MIN_CHUNK_SIZE;
+    static const char BINARY_MAGIC[8];
+    static const uint32_t BINARY_VERSION;
+    static const uint64_t BINARY_HEADER_SIZE;
+
+    static const char *findLineEnd(const char *, const char *);
+    static bool parseLine(const char *, const char *, unsigned int, const char *&, std::vector<coordinate_t> &);
+    static Curve *createCurve(const std::string &, const std::vector<coordinate_t> &, unsigned int, coordinate_t, std::vector<coordinate_t> &);
+    static void parseLines(const char *, const char *, unsigned int, coordinate_t, unsigned int, std::vector<Curve *> &);
+    static bool isBinaryCurvesFile(const char *, uint64_t);
+    static void parseBinaryCurves(const char *, uint64_t, unsigned int, coordinate_t, unsigned int, unsigned int, std::vector<Curve *> &);
+
 public:
-    static std::vector<Curve *> *parseCurvesFile(const std::string &, unsigned int, long double, unsigned int);
+    static Curve *parseCurve(const std::string &, unsigned int, coordinate_t, unsigned int);
+    static std::vector<Curve *> *parseCurvesFile(const std::string &, unsigned int, coordinate_t, unsigned int, unsigned int);
+    static bool isBinaryCurvesFile(const std::string &);
+    static bool writeBinaryCurvesFile(const std::string &, const std::vector<Curve *> &, uint32_t);
 };
 
 
@@ -0,0 +1,86 @@
+#include <iostream>
+#include "QueryStream.h"
+#include "../Parser/Parser.h"
+
+QueryStream::QueryStream(unsigned int dimensions, coordinate_t frequency, unsigned int complexity, unsigned int maxBatchSize) {
+
+    this->dimensions = dimensions;
+    this->frequency = frequency;
+    this->complexity = complexity;
+    this->maxBatchSize = maxBatchSize;
+    this->lineNumber = 0;
+}
+
+/* Utility/Guard function to create a QueryStream reading from the given path, where "-" stands for the standard input
+ * It returns nullptr if the path could not be opened for reading or if the Curves could not be parsed as dimensions-dimensional */
+QueryStream *QueryStream::createQueryStream(const std::string &path, unsigned int dimensions, coordinate_t frequency, unsigned int complexity, unsigned int maxBatchSize) {
+
+    if (dimensions == 0 || dimensions > 2 || maxBatchSize == 0)
+        return nullptr;
+
+    QueryStream *queryStream = new QueryStream(dimensions, frequency, complexity, maxBatchSize);
+
+    /* Opening the standard input through the file system, rather than using std::cin, lets QueryStream::nextBatch find out how many characters have already arrived */
+    queryStream->input.open(path == "-" ? "/dev/stdin" : path);
+
+    if (!queryStream->input.is_open()) {
+        delete queryStream;
+        return nullptr;
+    }
+
+    return queryStream;
+}
+
+/* Function to read the next batch of Query Curves, which blocks until a non-blank line arrives and returns nullptr once the stream has ended
+ * Invalid lines, as well as Curves whose complexity differs from the provided one, are not part of the batch but are reported by QueryStream::getRejectedLines
+ * Thus a batch may consist of rejected lines only, in which case it is empty */
+std::vector<Curve *> *QueryStream::nextBatch() {
+
+    std::vector<Curve *> *queryCurves = new std::vector<Curve *>;
+    this->rejectedLines.clear();
+
+    std::string line;
+
+    while (queryCurves->size() + this->rejectedLines.size() < this->maxBatchSize) {
+
+        /* Once a line is available, only the lines that have already arrived are added to the batch */
+        if ((!queryCurves->empty() || !this->rejectedLines.empty()) && this->input.rdbuf()->in_avail() <= 0)
+            break;
+
+        if (!std::getline(this->input, line))
+            break;
+
+        this->lineNumber++;
+
+        /* Blank lines e.g. a trailing newline are not Queries */
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        Curve *queryCurve = Parser::parseCurve(line, this->dimensions, this->frequency, this->complexity);
+
+        if (queryCurve != nullptr) {
+            queryCurves->push_back(queryCurve);
+            continue;
+        }
+
+        /* A rejected line is identified by its Query id - the text before its first '\t' - or by its line number in case it does not have one */
+        std::string::size_type idEnd = line.find('\t');
+        std::string id = (idEnd != std::string::npos) ? line.substr(0, idEnd) : "line " + std::to_string(this->lineNumber);
+
+        std::cout << "Error : Invalid Query at line " << this->lineNumber << " of the stream" << std::endl;
+        this->rejectedLines.push_back(std::make_pair(queryCurves->size(), id));
+    }
+
+    if (queryCurves->empty() && this->rejectedLines.empty()) {
+        delete queryCurves;
+        return nullptr;
+    }
+
+    return queryCurves;
+}
+
+/* Function to get the rejected lines of the last batch in the order they were read, each one as the number of the batch's Query Curves that were read before it and its identifier
+ * The identifier is the line's Query id, or "line N" where N is the line's number in the stream in case the line does not have one */
+const std::vector<std::pair<unsigned int, std::string>> &QueryStream::getRejectedLines() const {
+    return this->rejectedLines;
+}
@@ -0,0 +1,32 @@
+#ifndef QUERYSTREAM_H
+#define QUERYSTREAM_H
+
+#include <fstream>
+#include "../../Curve-Modules/Curve/Curve.h"
+
+/* Class that reads Query Curves in the format [curve_id y_1 y_2 ... y_n] incrementally from a file, a FIFO or the standard input
+ * Only a batch of Queries is held in memory at a time, thus a stream of any length is answered with bounded memory
+ * A batch consists of the first line that arrives and the lines that have already arrived after it, up to a maximum batch size
+ * The invalid lines of a batch are not silently dropped, see QueryStream::getRejectedLines */
+class QueryStream {
+
+private:
+    std::ifstream input;
+    unsigned int dimensions;
+    coordinate_t frequency;
+    unsigned int complexity;
+    unsigned int maxBatchSize;
+    unsigned int lineNumber;
+    std::vector<std::pair<unsigned int, std::string>> rejectedLines;
+
+    QueryStream(unsigned int, coordinate_t, unsigned int, unsigned int);
+
+public:
+    static QueryStream *createQueryStream(const std::string &, unsigned int, coordinate_t, unsigned int, unsigned int);
+
+    std::vector<Curve *> *nextBatch();
+    const std::vector<std::pair<unsigned int, std::string>> &getRejectedLines() const;
+};
+
+
+#endif
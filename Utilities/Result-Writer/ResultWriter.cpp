@@ -0,0 +1,346 @@
+#include <cstdio>
+#include <limits>
+#include "ResultWriter.h"
+#include "../File/File.h"
+
+const unsigned int ResultWriter::BUFFER_SIZE = 1 << 20;
+
+ResultWriter::ResultWriter(const std::string &filePath, const std::string &format, bool isEmpty) : file(filePath, std::ios::app) {
+
+    this->format = format;
+    this->isEmpty = isEmpty;
+    this->buffer.reserve(ResultWriter::BUFFER_SIZE + 4096);
+}
+
+/* Utility function to decide whether a std::string is one of the supported output formats or not */
+bool ResultWriter::isFormat(const std::string &format) {
+    return format == "text" || format == "csv" || format == "jsonl";
+}
+
+/* Utility/Guard function to create a ResultWriter which appends to the given file, which returns nullptr if the format is not supported or the file could not be opened */
+ResultWriter *ResultWriter::createResultWriter(const std::string &filePath, const std::string &format) {
+
+    if (!ResultWriter::isFormat(format))
+        return nullptr;
+
+    ResultWriter *resultWriter = new ResultWriter(filePath, format, !File::canOpenFile(filePath) || File::isFileEmpty(filePath));
+
+    if (!resultWriter->file.is_open()) {
+        delete resultWriter;
+        return nullptr;
+    }
+
+    return resultWriter;
+}
+
+ResultWriter::~ResultWriter() {
+    this->flush();
+}
+
+/* Function to write the buffered output to the file, which returns false if the file could not be written */
+bool ResultWriter::flush() {
+
+    if (!this->buffer.empty()) {
+        this->file.write(this->buffer.data(), this->buffer.size());
+        this->buffer.clear();
+    }
+
+    this->file.flush();
+
+    return !this->file.fail();
+}
+
+/* Utility function to write the buffered output to the file once it exceeds the size of the buffer */
+void ResultWriter::writeIfFull() {
+
+    if (this->buffer.size() >= ResultWriter::BUFFER_SIZE) {
+        this->file.write(this->buffer.data(), this->buffer.size());
+        this->buffer.clear();
+    }
+}
+
+/* Utility function to append a number either exactly as std::to_string formats it, which the text format relies on, or with enough digits to be read back exactly */
+void ResultWriter::appendNumber(double number, bool isExact) {
+
+    char characters[std::numeric_limits<double>::max_exponent10 + 32];
+
+    int length = std::snprintf(characters, sizeof(characters), isExact ? "%.17g" : "%f", number);
+
+    this->buffer.append(characters, length);
+}
+
+/* Utility function to append a std::string as a quoted CSV field or JSON string, escaping the characters that need to be escaped */
+void ResultWriter::appendString(const std::string &string) {
+
+    this->buffer += '"';
+
+    for (char character: string) {
+
+        if (character == '"')
+            this->buffer += (this->format == "csv") ? "\"\"" : "\\\"";
+
+        else if (this->format == "jsonl" && character == '\\')
+            this->buffer += "\\\\";
+
+        else if (this->format == "jsonl" && (unsigned char) character < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char) character);
+            this->buffer += escaped;
+        }
+
+        else
+            this->buffer += character;
+    }
+
+    this->buffer += '"';
+}
+
+/* Utility function to append the key of a JSON member, preceded by a comma unless it is the first member of the object */
+void ResultWriter::appendKey(const std::string &key) {
+
+    if (this->buffer.empty() || this->buffer.back() != '{')
+        this->buffer += ',';
+
+    this->appendString(key);
+    this->buffer += ':';
+}
+
+/* Utility function to append the header row of the csv format in case nothing has been written to the file yet */
+void ResultWriter::appendHeader() {
+
+    if (this->format == "csv" && this->isEmpty)
+        this->buffer += "query,approximate_neighbor,approximate_distance,approximate_time_ms,true_neighbor,true_distance,true_time_ms,error\n";
+
+    this->isEmpty = false;
+}
+
+/* Function to write the execution parameters, the first of which is the algorithm. They are omitted in the csv format */
+void ResultWriter::writeParameters(const std::vector<std::pair<std::string, std::string>> &parameters) {
+
+    if (this->format == "text") {
+
+        this->buffer += "\n\n--Execution parameters--\n";
+
+        for (const std::pair<std::string, std::string> &parameter: parameters)
+            this->buffer += "\n" + parameter.first + " : " + parameter.second;
+    }
+
+    else if (this->format == "jsonl") {
+
+        this->buffer += "{";
+        this->appendKey("type");
+        this->appendString("parameters");
+
+        for (const std::pair<std::string, std::string> &parameter: parameters) {
+            this->appendKey(parameter.first);
+            this->appendString(parameter.second);
+        }
+
+        this->buffer += "}\n";
+    }
+
+    this->writeIfFull();
+}
+
+/* Function to write the result of a Query, where a nullptr id stands for a missing - approximate or exact - nearest neighbor whose distance and duration are ignored */
+void ResultWriter::writeResult(const std::string &queryID, const std::string *approximateID, distance_t approximateDistance, double approximateDuration, const std::string *trueID, distance_t trueDistance, double trueDuration) {
+
+    if (this->format == "text") {
+
+        this->buffer += "\n\nQuery : " + queryID;
+
+        this->buffer += "\nApproximate Nearest Neighbor : ";
+        this->buffer += (approximateID != nullptr) ? *approximateID : "N/A";
+
+        this->buffer += "\nTrue Nearest Neighbor : ";
+        this->buffer += (trueID != nullptr) ? *trueID : "N/A";
+
+        this->buffer += "\ndistanceApproximate : ";
+        if (approximateID != nullptr)
+            this->appendNumber(approximateDistance, false);
+        else
+            this->buffer += "N/A";
+
+        this->buffer += "\ndistanceTrue : ";
+        if (trueID != nullptr)
+            this->appendNumber(trueDistance, false);
+        else
+            this->buffer += "N/A";
+
+        this->buffer += "\ntimeApproximate : ";
+        if (approximateID != nullptr) {
+            this->appendNumber(approximateDuration, false);
+            this->buffer += " ms";
+        }
+        else
+            this->buffer += "N/A";
+
+        this->buffer += "\ntimeTrue : ";
+        if (trueID != nullptr) {
+            this->appendNumber(trueDuration, false);
+            this->buffer += " ms";
+        }
+        else
+            this->buffer += "N/A";
+    }
+
+    else if (this->format == "csv") {
+
+        this->appendHeader();
+
+        this->appendString(queryID);
+        this->buffer += ',';
+
+        if (approximateID != nullptr) {
+            this->appendString(*approximateID);
+            this->buffer += ',';
+            this->appendNumber(approximateDistance, true);
+            this->buffer += ',';
+            this->appendNumber(approximateDuration, true);
+        }
+        else
+            this->buffer += ",,";
+
+        this->buffer += ',';
+
+        if (trueID != nullptr) {
+            this->appendString(*trueID);
+            this->buffer += ',';
+            this->appendNumber(trueDistance, true);
+            this->buffer += ',';
+            this->appendNumber(trueDuration, true);
+        }
+        else
+            this->buffer += ",,";
+
+        this->buffer += ",\n";
+    }
+
+    else {
+
+        this->buffer += "{";
+        this->appendKey("type");
+        this->appendString("query");
+        this->appendKey("query");
+        this->appendString(queryID);
+
+        this->appendKey("approximateNeighbor");
+        if (approximateID != nullptr) {
+            this->appendString(*approximateID);
+            this->appendKey("distanceApproximate");
+            this->appendNumber(approximateDistance, true);
+            this->appendKey("timeApproximate");
+            this->appendNumber(approximateDuration, true);
+        }
+        else
+            this->buffer += "null,\"distanceApproximate\":null,\"timeApproximate\":null";
+
+        this->appendKey("trueNeighbor");
+        if (trueID != nullptr) {
+            this->appendString(*trueID);
+            this->appendKey("distanceTrue");
+            this->appendNumber(trueDistance, true);
+            this->appendKey("timeTrue");
+            this->appendNumber(trueDuration, true);
+        }
+        else
+            this->buffer += "null,\"distanceTrue\":null,\"timeTrue\":null";
+
+        this->buffer += "}\n";
+    }
+
+    this->isEmpty = false;
+    this->writeIfFull();
+}
+
+/* Function to write a record in place of the result of a Query that could not be answered e.g. a malformed line of a stream of Queries
+ * Thus every Query gets exactly one record in the order that the Queries were read */
+void ResultWriter::writeError(const std::string &queryID, const std::string &message) {
+
+    if (this->format == "text")
+        this->buffer += "\n\nQuery : " + queryID + "\nError : " + message;
+
+    else if (this->format == "csv") {
+
+        this->appendHeader();
+
+        this->appendString(queryID);
+        this->buffer += ",,,,,,,";
+        this->appendString(message);
+        this->buffer += '\n';
+    }
+
+    else {
+
+        this->buffer += "{";
+        this->appendKey("type");
+        this->appendString("error");
+        this->appendKey("query");
+        this->appendString(queryID);
+        this->appendKey("error");
+        this->appendString(message);
+        this->buffer += "}\n";
+    }
+
+    this->writeIfFull();
+}
+
+/* Function to write the average durations and the maximum approximation factor of an execution. They are omitted in the csv format
+ * A maximum approximation factor of std::numeric_limits<double>::min() stands for a missing one and std::numeric_limits<double>::max() for an infinite one */
+void ResultWriter::writeSummary(double averageApproximateDuration, double averageTrueDuration, bool hasTrueDuration, double maximumApproximationFactor) {
+
+    bool hasMaximumApproximationFactor = maximumApproximationFactor != std::numeric_limits<double>::min();
+    bool isInfinite = maximumApproximationFactor == std::numeric_limits<double>::max();
+
+    if (this->format == "text") {
+
+        this->buffer += "\n\ntApproximateAverage : ";
+        this->appendNumber(averageApproximateDuration, false);
+        this->buffer += " ms";
+
+        this->buffer += "\ntApproximateTrue : ";
+        if (hasTrueDuration) {
+            this->appendNumber(averageTrueDuration, false);
+            this->buffer += " ms";
+        }
+        else
+            this->buffer += "N/A";
+
+        this->buffer += "\nMAF : ";
+        if (!hasMaximumApproximationFactor)
+            this->buffer += "N/A";
+        else if (!isInfinite)
+            this->appendNumber(maximumApproximationFactor, false);
+        else
+            this->buffer += "+∞";
+    }
+
+    else if (this->format == "jsonl") {
+
+        this->buffer += "{";
+        this->appendKey("type");
+        this->appendString("summary");
+
+        this->appendKey("tApproximateAverage");
+        this->appendNumber(averageApproximateDuration, true);
+
+        this->appendKey("tApproximateTrue");
+        if (hasTrueDuration)
+            this->appendNumber(averageTrueDuration, true);
+        else
+            this->buffer += "null";
+
+        /* JSON has no infinity, thus an infinite maximum approximation factor is written as a string */
+        this->appendKey("MAF");
+        if (!hasMaximumApproximationFactor)
+            this->buffer += "null";
+        else if (!isInfinite)
+            this->appendNumber(maximumApproximationFactor, true);
+        else
+            this->appendString("+inf");
+
+        this->buffer += "}\n";
+    }
+
+    this->writeIfFull();
+}
@@ -0,0 +1,45 @@
+#ifndef RESULTWRITER_H
+#define RESULTWRITER_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include "../../Metric-Modules/Continuous-Frechet/include/types.hpp"
+
+/* Class that appends the results of the Queries to the Output file in one of the following formats :
+ * text  : the human-readable layout described in the README -- section Output file
+ * csv   : one row per Query preceded by a header row in case the file is empty, where a missing value is an empty field and the last field is only set for a Query that could not be answered
+ * jsonl : one JSON object per line for the execution parameters, each Query and the summary, where a missing value is null
+ * The output is gathered in a large buffer which is only written to the file when it fills up or when ResultWriter::flush is called, e.g. at the end of a batch of Queries */
+class ResultWriter {
+
+private:
+    static const unsigned int BUFFER_SIZE;
+
+    std::ofstream file;
+    std::string format;
+    std::string buffer;
+    bool isEmpty;
+
+    ResultWriter(const std::string &, const std::string &, bool);
+
+    void appendNumber(double, bool);
+    void appendString(const std::string &);
+    void appendKey(const std::string &);
+    void writeIfFull();
+    void appendHeader();
+
+public:
+    static ResultWriter *createResultWriter(const std::string &, const std::string &);
+    static bool isFormat(const std::string &);
+    ~ResultWriter();
+
+    void writeParameters(const std::vector<std::pair<std::string, std::string>> &);
+    void writeResult(const std::string &, const std::string *, distance_t, double, const std::string *, distance_t, double);
+    void writeError(const std::string &, const std::string &);
+    void writeSummary(double, double, bool, double);
+    bool flush();
+};
+
+
+#endif
@@ -1,6 +1,8 @@
 #include <sstream>
 #include "String.h"
 #include <limits>
+#include <cstdint>
+#include <cstdlib>
 
 const unsigned int String::INVALID_PARAMETERS = std::numeric_limits<unsigned int>::max();
 
@@ -76,6 +78,83 @@ bool String::isFloatingPointNumber(const std::string &string) {
     return true;
 }
 
+/* Utility function to validate the characters [begin, end) the same way String::isFloatingPointNumber does and convert them to a floating point number without copying them
+ * A number with at most 19 significant digits and at most 27 decimal digits (on x86 extended precision) is converted with a single division of 2 exactly representable values, which is correctly rounded
+ * Any other number is converted through std::strtold, thus the result is always identical to the one std::stold would produce
+ * In contrast to String::isFloatingPointNumber a lone sign is rejected, as std::stold would not be able to convert it */
+bool String::parseFloatingPointNumber(const char *begin, const char *end, long double &value) {
+
+    /* Bounds of the exactly representable mantissas and powers of ten, in case long double is no wider than double they are 10^15 and 10^22 respectively */
+    static const unsigned int MAX_EXACT_DIGITS = std::numeric_limits<long double>::digits >= 64 ? 19 : 15;
+    static const int MAX_EXACT_EXPONENT = std::numeric_limits<long double>::digits >= 64 ? 27 : 22;
+    static const long double POWERS_OF_TEN[] = {1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+                                                1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L};
+
+    if (begin == end || end[-1] == '.')
+        return false;
+
+    const char *current = begin;
+    bool isNegative = false;
+
+    if (*current == '+' || *current == '-') {
+        isNegative = (*current == '-');
+        current++;
+    }
+    else if (!String::isDigit(*current))
+        return false;
+
+    if (current == end)
+        return false;
+
+    uint64_t mantissa = 0;
+    unsigned int significantDigits = 0;
+    int exponent = 0;
+    bool hasDecimalPoint = false;
+    bool isExact = true;
+
+    for (; current != end; ++current) {
+
+        if (*current == '.') {
+
+            if (hasDecimalPoint)
+                return false;
+
+            hasDecimalPoint = true;
+            continue;
+        }
+
+        if (!String::isDigit(*current))
+            return false;
+
+        unsigned int digit = *current - '0';
+
+        /* Leading zeros are not significant */
+        if (mantissa != 0 || digit != 0) {
+            if (significantDigits == MAX_EXACT_DIGITS)
+                isExact = false;
+            else {
+                mantissa = mantissa * 10 + digit;
+                significantDigits++;
+            }
+        }
+
+        if (hasDecimalPoint)
+            exponent++;
+    }
+
+    if (isExact && exponent <= MAX_EXACT_EXPONENT) {
+        value = (long double) mantissa / POWERS_OF_TEN[exponent];
+        if (isNegative)
+            value = -value;
+        return true;
+    }
+
+    std::string string(begin, end);
+    value = std::strtold(string.c_str(), nullptr);
+
+    return true;
+}
+
 /* Utility function to decide whether a std::string is a whole point number or not */
 bool String::isWholeNumber(const std::string &string) {
 
@@ -14,6 +14,7 @@ public:
     static bool isBoolean(const std::string &);
     static bool isWholeNumber(const std::string &);
     static bool isFloatingPointNumber(const std::string&);
+    static bool parseFloatingPointNumber(const char *, const char *, long double &);
     static unsigned int hammingDistance(const std::string &, const std::string &);
 };
 
@@ -0,0 +1,21 @@
+#include <algorithm>
+#include "VisitedSet.h"
+
+VisitedSet::VisitedSet() {
+    this->epoch = 0;
+}
+
+/* Function to start a new query over the ids 0, 1, ... , size - 1 */
+void VisitedSet::clear(unsigned int size) {
+
+    if (this->stamps.size() < size)
+        this->stamps.resize(size, 0);
+
+    this->epoch++;
+
+    /* Once the epoch wraps around the stamps of past queries could collide with the new epochs, thus they are reset */
+    if (this->epoch == 0) {
+        std::fill(this->stamps.begin(), this->stamps.end(), 0);
+        this->epoch = 1;
+    }
+}
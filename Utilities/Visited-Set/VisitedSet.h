@@ -0,0 +1,31 @@
+#ifndef VISITEDSET_H
+#define VISITEDSET_H
+
+#include <vector>
+
+/* Class that keeps track of the ids - 0, 1, ... , size - 1 - that have been visited during a query
+ * Each id is stamped with the epoch of the query that visited it, thus starting a new query only increments the epoch instead of clearing the whole array */
+
+class VisitedSet {
+
+private:
+    std::vector<unsigned int> stamps;
+    unsigned int epoch;
+
+public:
+    VisitedSet();
+    void clear(unsigned int);
+
+    /* Function to mark the given id as visited, which returns false if it was already visited during the current query */
+    inline bool visit(unsigned int id) {
+
+        if (this->stamps[id] == this->epoch)
+            return false;
+
+        this->stamps[id] = this->epoch;
+        return true;
+    }
+};
+
+
+#endif
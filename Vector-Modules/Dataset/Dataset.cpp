@@ -0,0 +1,152 @@
+#include <cstdlib>
+#include <new>
+#include "Dataset.h"
+#include "../../Curve-Modules/Curve/Curve.h"
+
+/* Size of a cache line in bytes */
+const unsigned int Dataset::ALIGNMENT = 64;
+
+/* Utility/Guard function to create the Dataset of the vectorial representations of a set of Curves
+ * All the vectorial representations should be of the same dimensions, otherwise nullptr is returned
+ * The vectorial representations are written directly into the Dataset without being calculated by each Curve */
+Dataset *Dataset::createDataset(const std::vector<Curve *> &curves, bool columnMajorLayout) {
+
+    if (curves.empty())
+        return nullptr;
+
+    unsigned int dimensions = curves[0]->getComplexity() * curves[0]->getDimensions();
+    for (Curve *curve: curves)
+        if (curve->getComplexity() * curve->getDimensions() != dimensions)
+            return nullptr;
+
+    Dataset *dataset = new Dataset(curves.size(), dimensions, columnMajorLayout);
+
+    for (unsigned int i = 0; i < dataset->size; ++i) {
+
+        coordinate_t *row = dataset->rowMajorCoordinates + (unsigned long) i * dataset->rowStride;
+
+        /* Concatenate the coordinates of the Curve's Points */
+        unsigned int j = 0;
+        for (Vector *vector: curves[i]->getPoints())
+            for (unsigned int d = 0; d < vector->getDimensions(); ++d)
+                row[j++] = vector->getCoordinates()[d];
+
+        if (dataset->columnMajorCoordinates != nullptr)
+            for (j = 0; j < dimensions; ++j)
+                dataset->columnMajorCoordinates[(unsigned long) j * dataset->columnStride + i] = row[j];
+
+        /* The views std::vector has been reserved in advance, thus the addresses of its Points remain valid */
+        dataset->views.emplace_back(curves[i], row, dimensions);
+        dataset->points.push_back(&dataset->views.back());
+    }
+
+    return dataset;
+}
+
+Dataset::Dataset(unsigned int size, unsigned int dimensions, bool columnMajorLayout) {
+
+    this->size = size;
+    this->dimensions = dimensions;
+    this->rowStride = Dataset::calculateStride(dimensions);
+    this->columnStride = Dataset::calculateStride(size);
+
+    /* Padding coordinates are zeroed so that the buffers never contain uninitialized values */
+    unsigned long rowMajorLength = (unsigned long) this->size * this->rowStride;
+    this->rowMajorCoordinates = Dataset::allocate(rowMajorLength);
+    for (unsigned long i = 0; i < rowMajorLength; ++i)
+        this->rowMajorCoordinates[i] = 0.0;
+
+    this->columnMajorCoordinates = nullptr;
+    if (columnMajorLayout) {
+
+        unsigned long columnMajorLength = (unsigned long) this->dimensions * this->columnStride;
+        this->columnMajorCoordinates = Dataset::allocate(columnMajorLength);
+        for (unsigned long i = 0; i < columnMajorLength; ++i)
+            this->columnMajorCoordinates[i] = 0.0;
+    }
+
+    this->views.reserve(size);
+    this->points.reserve(size);
+}
+
+Dataset::~Dataset() {
+
+    /* The views have to be destroyed before the buffer they point to */
+    this->points.clear();
+    this->views.clear();
+
+    free(this->rowMajorCoordinates);
+    free(this->columnMajorCoordinates);
+}
+
+/* Utility function to round a number of coordinates up to the next multiple of a cache line */
+unsigned int Dataset::calculateStride(unsigned int length) {
+
+    unsigned int coordinatesPerLine = Dataset::ALIGNMENT / sizeof(coordinate_t);
+
+    if (length == 0)
+        return coordinatesPerLine;
+
+    return ((length + coordinatesPerLine - 1) / coordinatesPerLine) * coordinatesPerLine;
+}
+
+/* Utility function to allocate a cache line aligned buffer of |length| coordinates */
+coordinate_t *Dataset::allocate(unsigned long length) {
+
+    void *buffer = nullptr;
+
+    if (posix_memalign(&buffer, Dataset::ALIGNMENT, length * sizeof(coordinate_t)) != 0)
+        throw std::bad_alloc();
+
+    return static_cast<coordinate_t *>(buffer);
+}
+
+unsigned int Dataset::getSize() const {
+    return this->size;
+}
+
+unsigned int Dataset::getDimensions() const {
+    return this->dimensions;
+}
+
+unsigned int Dataset::getRowStride() const {
+    return this->rowStride;
+}
+
+unsigned int Dataset::getColumnStride() const {
+    return this->columnStride;
+}
+
+bool Dataset::hasColumnMajorLayout() const {
+    return this->columnMajorCoordinates != nullptr;
+}
+
+const std::vector<Point *> &Dataset::getPoints() const {
+    return this->points;
+}
+
+Point *Dataset::getPoint(unsigned int index) const {
+
+    if (index < this->size)
+        return this->points[index];
+
+    return nullptr;
+}
+
+/* Utility function to get the coordinates of the index-th Point */
+const coordinate_t *Dataset::getRow(unsigned int index) const {
+
+    if (index < this->size)
+        return this->rowMajorCoordinates + (unsigned long) index * this->rowStride;
+
+    return nullptr;
+}
+
+/* Utility function to get the index-th coordinate of all the Points, provided that the Dataset keeps a column-major layout */
+const coordinate_t *Dataset::getColumn(unsigned int index) const {
+
+    if (this->columnMajorCoordinates != nullptr && index < this->dimensions)
+        return this->columnMajorCoordinates + (unsigned long) index * this->columnStride;
+
+    return nullptr;
+}
@@ -0,0 +1,49 @@
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <vector>
+#include "../Point/Point.h"
+
+/* Forward declaration of Curve class */
+class Curve;
+
+/* Class that stores the coordinates of a set of equally dimensional Points in a single aligned and contiguous buffer
+ * Each row of the buffer starts at a cache line boundary and the Points of a Dataset are lightweight views into the buffer
+ * A column-major copy of the coordinates may also be kept for routines that stream a single coordinate across all the Points */
+class Dataset {
+
+private:
+    static const unsigned int ALIGNMENT;
+
+    unsigned int size;
+    unsigned int dimensions;
+    unsigned int rowStride;
+    unsigned int columnStride;
+    coordinate_t *rowMajorCoordinates;
+    coordinate_t *columnMajorCoordinates;
+    std::vector<Point> views;
+    std::vector<Point *> points;
+
+    Dataset(unsigned int, unsigned int, bool);
+    static unsigned int calculateStride(unsigned int);
+    static coordinate_t *allocate(unsigned long);
+
+public:
+    static Dataset *createDataset(const std::vector<Curve *> &, bool);
+    ~Dataset();
+
+    unsigned int getSize() const;
+    unsigned int getDimensions() const;
+    unsigned int getRowStride() const;
+    unsigned int getColumnStride() const;
+    bool hasColumnMajorLayout() const;
+
+    const std::vector<Point *> &getPoints() const;
+    Point *getPoint(unsigned int) const;
+    const coordinate_t *getRow(unsigned int) const;
+    const coordinate_t *getColumn(unsigned int) const;
+
+};
+
+
+#endif
@@ -1,14 +1,21 @@
 #include "Point.h"
 
-Point::Point(const std::vector<long double> &coordinates) : Vector(coordinates) {
+Point::Point(const std::vector<coordinate_t> &coordinates) : Vector(coordinates) {
     this->curve = nullptr;
 }
 
 
-Point::Point(Curve *curve, const std::vector<long double> &coordinates) : Vector(coordinates) {
+Point::Point(Curve *curve, const std::vector<coordinate_t> &coordinates) : Vector(coordinates) {
     this->curve = curve;
 }
 
+/* View constructor : the Point does not own the provided coordinates, which should outlive it */
+Point::Point(Curve *curve, const coordinate_t *coordinates, unsigned int dimensions) : Vector() {
+    this->curve = curve;
+    this->coordinates = const_cast<coordinate_t *>(coordinates);
+    this->dimensions = dimensions;
+}
+
 Curve *Point::getCurve() const {
     return this->curve;
 }
@@ -14,8 +14,9 @@ private:
     Curve *curve;
 
 public:
-    explicit Point(const std::vector<long double> &);
-    Point(Curve *, const std::vector<long double> &);
+    explicit Point(const std::vector<coordinate_t> &);
+    Point(Curve *, const std::vector<coordinate_t> &);
+    Point(Curve *, const coordinate_t *, unsigned int);
     Curve *getCurve() const;
 
 };
@@ -2,13 +2,61 @@
 #include <chrono>
 #include "Vector.h"
 #include "../../Metric-Modules/Vector-Metric/VectorMetric.h"
+#include "../../Metric-Modules/Distance-Kernels/DistanceKernels.h"
 
-const long double Vector::INVALID_PARAMETERS = std::numeric_limits<long double>::max();
+const coordinate_t Vector::INVALID_PARAMETERS = std::numeric_limits<coordinate_t>::max();
 
-Vector::Vector(const std::vector<long double> &coordinates) {
+Vector::Vector(const std::vector<coordinate_t> &coordinates) {
 
-    for (long double coordinate: coordinates)
-        this->coordinates.push_back(coordinate);
+    this->dimensions = coordinates.size();
+    this->coordinates = new coordinate_t[this->dimensions];
+    this->ownsCoordinates = true;
+
+    for (unsigned int i = 0; i < this->dimensions; ++i)
+        this->coordinates[i] = coordinates[i];
+}
+
+/* Constructor of an empty view, which is used by derived classes to refer to coordinates they do not own */
+Vector::Vector() {
+
+    this->dimensions = 0;
+    this->coordinates = nullptr;
+    this->ownsCoordinates = false;
+}
+
+/* Copying a Vector, even a view, always results in a Vector which owns a private copy of the coordinates */
+Vector::Vector(const Vector &vector) {
+
+    this->dimensions = vector.dimensions;
+    this->coordinates = new coordinate_t[this->dimensions];
+    this->ownsCoordinates = true;
+
+    for (unsigned int i = 0; i < this->dimensions; ++i)
+        this->coordinates[i] = vector.coordinates[i];
+}
+
+Vector &Vector::operator=(const Vector &vector) {
+
+    if (&vector == this)
+        return *this;
+
+    if (this->ownsCoordinates)
+        delete[] this->coordinates;
+
+    this->dimensions = vector.dimensions;
+    this->coordinates = new coordinate_t[this->dimensions];
+    this->ownsCoordinates = true;
+
+    for (unsigned int i = 0; i < this->dimensions; ++i)
+        this->coordinates[i] = vector.coordinates[i];
+
+    return *this;
+}
+
+Vector::~Vector() {
+
+    if (this->ownsCoordinates)
+        delete[] this->coordinates;
 }
 
 /* Utility function to create a unit Vector, which is normalised according to the p-norm */
@@ -19,17 +67,17 @@ Vector *Vector::randomUnitVector(unsigned int dimensions, double p) {
 
     /* Random number distribution according to a Gaussian distribution */
     std::default_random_engine defaultRandomEngine(std::chrono::high_resolution_clock::now().time_since_epoch().count());
-    std::normal_distribution<long double> distribution(0.0, 1.0);
+    std::normal_distribution<coordinate_t> distribution(0.0, 1.0);
 
     /* Create |dimensions| random coordinates */
-    std::vector<long double> coordinates;
+    std::vector<coordinate_t> coordinates;
     for (unsigned int i = 0; i < dimensions; ++i)
         coordinates.push_back(distribution(defaultRandomEngine));
 
     Vector *unitVector = new Vector(coordinates);
 
     /* Normalise the Vector according to the p-norm */
-    long double pNorm = VectorMetric::norm(*unitVector, p);
+    coordinate_t pNorm = VectorMetric::norm(*unitVector, p);
     for (unsigned int i = 0; i < unitVector->getDimensions(); ++i)
         unitVector->coordinates[i] /= pNorm;
 
@@ -37,36 +85,36 @@ Vector *Vector::randomUnitVector(unsigned int dimensions, double p) {
 }
 
 /* Inner product operator */
-long double Vector::operator*(const Vector &vector) const {
+coordinate_t Vector::operator*(const Vector &vector) const {
 
     if (vector.getDimensions() != this->getDimensions())
         return Vector::INVALID_PARAMETERS;
 
-    long double innerProduct = 0;
-    for (long unsigned i = 0; i < this->coordinates.size(); ++i)
-        innerProduct += (this->coordinates.at(i) * vector.coordinates.at(i));
-
-    return innerProduct;
+    return DistanceKernels::innerProduct(this->coordinates, vector.coordinates, this->dimensions);
 }
 
 unsigned int Vector::getDimensions() const {
-    return this->coordinates.size();
+    return this->dimensions;
 }
 
-const std::vector<long double> &Vector::getCoordinates() const {
+const coordinate_t *Vector::getCoordinates() const {
     return this->coordinates;
 }
 
+bool Vector::isView() const {
+    return !this->ownsCoordinates;
+}
+
 /* Utility function to check whether a Vector is equal to another Vector */
 bool Vector::equals(const Vector &vector) const {
 
     if (&vector == this)
         return true;
 
-    if (this->coordinates.size() != vector.coordinates.size())
+    if (this->dimensions != vector.dimensions)
         return false;
 
-    for (unsigned int i = 0; i < this->coordinates.size(); ++i)
+    for (unsigned int i = 0; i < this->dimensions; ++i)
         if (this->coordinates[i] != vector.coordinates[i])
             return false;
 
@@ -87,11 +135,11 @@ Vector *Vector::meanVector(const std::vector<Vector *> &vectors) {
             return nullptr;
 
 
-    std::vector<long double> coordinates;
+    std::vector<coordinate_t> coordinates;
 
     for (unsigned int i = 0; i < dimensions; ++i) {
 
-        long double coordinate = 0.0;
+        coordinate_t coordinate = 0.0;
 
         for (unsigned int j = 0; j < vectors.size(); ++j)
             coordinate += vectors[j]->getCoordinates()[i];
@@ -108,7 +156,7 @@ Vector *Vector::meanVector(const std::vector<Vector *> &vectors) {
 /* Utility - operator defined for the provided Continuous Frechet Distance library */
 Vector Vector::operator-(const Vector &vector) const {
 
-    std::vector<long double> vectorCoordinates;
+    std::vector<coordinate_t> vectorCoordinates;
 
     for (unsigned int i = 0; i < this->getDimensions(); ++i)
         vectorCoordinates.push_back(this->coordinates[i] - vector.coordinates[i]);
@@ -121,7 +169,7 @@ Vector Vector::operator-(const Vector &vector) const {
 /* Utility + operator defined for the provided Continuous Frechet Distance library */
 Vector Vector::operator+(const Vector &vector) const {
 
-    std::vector<long double> vectorCoordinates;
+    std::vector<coordinate_t> vectorCoordinates;
 
     for (unsigned int i = 0; i < this->getDimensions(); ++i)
         vectorCoordinates.push_back(this->coordinates[i] + vector.coordinates[i]);
@@ -131,18 +179,27 @@ Vector Vector::operator+(const Vector &vector) const {
     return result;
 }
 
-/* Utility function defined for the provided Continuous Frechet Distance library */
+/* Utility function defined for the provided Continuous Frechet Distance library
+ * The differences are kept in StackCoordinates instead of temporary Vectors, whose allocations would otherwise dominate the Continuous Frechet distance
+ * The same DistanceKernels as Vector::operator* and Vector::length_sqr are used, thus the results are identical */
 Interval Vector::ball_intersection_interval(const distance_t distance_sqr, const Vector &line_start, const Vector &line_end) const {
 
-    const Vector u = line_end - line_start, v = *this - line_start;
-    const parameter_t ulen_sqr = u.length_sqr(), vlen_sqr = v.length_sqr();
+    StackCoordinates uCoordinates(this->dimensions), vCoordinates(this->dimensions);
+    coordinate_t *u = uCoordinates.get(), *v = vCoordinates.get();
+
+    for (unsigned int i = 0; i < this->dimensions; ++i) {
+        u[i] = line_end.coordinates[i] - line_start.coordinates[i];
+        v[i] = this->coordinates[i] - line_start.coordinates[i];
+    }
+
+    const parameter_t ulen_sqr = DistanceKernels::innerProduct(u, u, this->dimensions), vlen_sqr = DistanceKernels::innerProduct(v, v, this->dimensions);
 
     if (near_eq(ulen_sqr, parameter_t(0))) {
         if (vlen_sqr <= distance_sqr) return Interval(parameter_t(0), parameter_t(1));
         else return Interval();
     }
 
-    const parameter_t p = -2. * ((u * v) / ulen_sqr), q = vlen_sqr / ulen_sqr - distance_sqr / ulen_sqr;
+    const parameter_t p = -2. * (DistanceKernels::innerProduct(u, v, this->dimensions) / ulen_sqr), q = vlen_sqr / ulen_sqr - distance_sqr / ulen_sqr;
 
     const parameter_t phalf_sqr = p * p / 4., discriminant = phalf_sqr - q;
 
@@ -157,15 +214,27 @@ Interval Vector::ball_intersection_interval(const distance_t distance_sqr, const
 
 }
 
-/* Utility function defined for the provided Continuous Frechet Distance library */
+/* Utility function defined for the provided Continuous Frechet Distance library, which keeps the differences and the projection in StackCoordinates like Vector::ball_intersection_interval */
 distance_t Vector::line_segment_dist_sqr(const Vector &p1, const Vector &p2) const {
 
-    const Vector u = p2 - p1;
-    parameter_t projection_param = (*this - p1) * u / (u * u);
+    StackCoordinates uCoordinates(this->dimensions), vCoordinates(this->dimensions);
+    coordinate_t *u = uCoordinates.get(), *v = vCoordinates.get();
+
+    for (unsigned int i = 0; i < this->dimensions; ++i) {
+        u[i] = p2.coordinates[i] - p1.coordinates[i];
+        v[i] = this->coordinates[i] - p1.coordinates[i];
+    }
+
+    parameter_t projection_param = DistanceKernels::innerProduct(v, u, this->dimensions) / DistanceKernels::innerProduct(u, u, this->dimensions);
     if (projection_param < parameter_t(0)) projection_param = parameter_t(0);
     else if (projection_param > parameter_t(1)) projection_param = parameter_t(1);
-    const Vector projection = p1 + u * projection_param;
-    return projection.dist_sqr(*this);
+
+    /* The projection replaces the difference v, which is no longer needed */
+    coordinate_t *projection = v;
+    for (unsigned int i = 0; i < this->dimensions; ++i)
+        projection[i] = p1.coordinates[i] + (coordinate_t) (u[i] * projection_param);
+
+    return DistanceKernels::squaredEuclidean(projection, this->coordinates, this->dimensions);
 }
 
 /* Utility function defined for the provided Continuous Frechet Distance library */
@@ -183,9 +252,9 @@ std::string Vector::toString() {
 
     std::string stringRepresentation = "(";
 
-    for (long unsigned int i = 0; i < this->coordinates.size(); ++i) {
+    for (unsigned int i = 0; i < this->dimensions; ++i) {
         stringRepresentation += std::to_string(this->coordinates[i]);
-        if (i < this->coordinates.size() - 1)
+        if (i < this->dimensions - 1)
             stringRepresentation += ",";
     }
 
@@ -195,12 +264,12 @@ std::string Vector::toString() {
 
 }
 
-long double Vector::operator[](unsigned int index) const {
+coordinate_t Vector::operator[](unsigned int index) const {
 
-    if (index < this->coordinates.size())
+    if (index < this->dimensions)
         return this->coordinates[index];
 
-    return std::numeric_limits<long double>::max();
+    return std::numeric_limits<coordinate_t>::max();
 }
 
 
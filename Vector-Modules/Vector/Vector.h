@@ -9,17 +9,49 @@
 class Vector {
 
 protected:
-    std::vector<long double> coordinates;
+    coordinate_t *coordinates;
+    unsigned int dimensions;
+    bool ownsCoordinates;
+
+    Vector();
+
+    static const unsigned int MAX_STACK_DIMENSIONS = 16;
+
+    /* Fixed-size coordinates on the stack, which fall back to the heap for Vectors of more than MAX_STACK_DIMENSIONS dimensions */
+    class StackCoordinates {
+        coordinate_t stackCoordinates[MAX_STACK_DIMENSIONS];
+        std::vector<coordinate_t> heapCoordinates;
+        coordinate_t *coordinates;
+
+    public:
+        explicit StackCoordinates(unsigned int dimensions) : coordinates(stackCoordinates) {
+            if (dimensions > MAX_STACK_DIMENSIONS) {
+                this->heapCoordinates.resize(dimensions);
+                this->coordinates = this->heapCoordinates.data();
+            }
+        }
+
+        StackCoordinates(const StackCoordinates &) = delete;
+        StackCoordinates &operator=(const StackCoordinates &) = delete;
+
+        coordinate_t *get() {
+            return this->coordinates;
+        }
+    };
 
 public:
-    static const long double INVALID_PARAMETERS;
-    explicit Vector(const std::vector<long double> &);
+    static const coordinate_t INVALID_PARAMETERS;
+    explicit Vector(const std::vector<coordinate_t> &);
+    Vector(const Vector &);
+    Vector &operator=(const Vector &);
+    ~Vector();
 
     std::string toString();
     bool equals(const Vector &) const;
     unsigned int getDimensions() const;
-    const std::vector<long double> &getCoordinates() const;
-    long double operator[](unsigned int) const;
+    const coordinate_t *getCoordinates() const;
+    bool isView() const;
+    coordinate_t operator[](unsigned int) const;
 
 
     distance_t dist_sqr(const Vector &) const;
@@ -31,7 +63,7 @@ public:
     template<typename T>
     Vector operator*(const T multiplier) const {
 
-        std::vector<long double> vectorCoordinates;
+        std::vector<coordinate_t> vectorCoordinates;
 
         for (unsigned int i = 0; i < this->getDimensions(); ++i)
             vectorCoordinates.push_back(this->coordinates[i] * multiplier);
@@ -43,7 +75,7 @@ public:
 
     Vector operator-(const Vector &) const;
     Vector operator+(const Vector &) const;
-    long double operator*(const Vector &) const;
+    coordinate_t operator*(const Vector &) const;
 
 
     static Vector *randomUnitVector(unsigned int, double);